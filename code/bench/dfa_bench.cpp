@@ -0,0 +1,861 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Benchmarks for DFA operations.
+/// \author     DFA library contributors
+/// \version    0.1.0
+/// \date       16.10.2026
+/// \copyright  © DFA library contributors 2026.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "fsa/auto_dfa.hpp"
+#include "fsa/batch_player.hpp"
+#include "fsa/dfa.hpp"
+#include "fsa/compiled_dfa.hpp"
+#include "fsa/dfa_image.hpp"
+#include "fsa/lazy_dfa.hpp"
+#include "fsa/multi_stream_player.hpp"
+#include "fsa/nfa.hpp"
+#include "fsa/parallel_player.hpp"
+#include "fsa/regex.hpp"
+#include "fsa/trace.hpp"
+
+typedef Dfa<int, char> IntCharDfa;
+typedef DfaPlayer<int, char> IntCharDfaPlayer;
+typedef CompiledDfa<int, char> IntCharCompiledDfa;
+typedef CompiledDfaPlayer<int, char> IntCharCompiledDfaPlayer;
+typedef BasicCompiledDfaPlayer<int, char, NullListener> IntCharBareDfaPlayer;
+typedef BasicCompiledDfaPlayer<int, char, TraceListener<char>>
+        IntCharTracingDfaPlayer;
+typedef MultiStreamDfaPlayer<int, char> IntCharMultiStreamDfaPlayer;
+typedef SharedDfa<int, char> IntCharSharedDfa;
+typedef BatchDfaPlayer<int, char> IntCharBatchDfaPlayer;
+typedef ParallelDfaPlayer<int, char> IntCharParallelDfaPlayer;
+typedef ShengDfa<int, char> IntCharShengDfa;
+typedef ShengDfaPlayer<int, char> IntCharShengDfaPlayer;
+typedef StrideDfa<int, char> IntCharStrideDfa;
+typedef StrideDfaPlayer<int, char> IntCharStrideDfaPlayer;
+typedef AccelDfa<int, char> IntCharAccelDfa;
+typedef AccelDfaPlayer<int, char> IntCharAccelDfaPlayer;
+typedef AutoDfa<int, char> IntCharAutoDfa;
+typedef AutoDfaPlayer<int, char> IntCharAutoDfaPlayer;
+typedef DfaImage<int, char> IntCharDfaImage;
+typedef Nfa<int, char> IntCharNfa;
+typedef LazyDfa<int, char> IntCharLazyDfa;
+typedef LazyDfaPlayer<int, char> IntCharLazyDfaPlayer;
+
+
+/// Measures wall-clock time of a code fragment in milliseconds.
+class Stopwatch {
+public:
+    Stopwatch() : _start(std::chrono::steady_clock::now()) {}
+
+    double ms() const
+    {
+        return std::chrono::duration<double, std::milli>(
+                    std::chrono::steady_clock::now() - _start).count();
+    }
+
+protected:
+    std::chrono::steady_clock::time_point _start;
+}; // class Stopwatch
+
+
+/// Collects records of benchmark results and prints them as a JSON document.
+class JsonReport {
+public:
+
+    /// Starts a new record of the benchmark \a name.
+    JsonReport& add(const std::string& name)
+    {
+        _records.emplace_back();
+        return field("name", name);
+    }
+
+    /// Adds the string field \a key to the current record.
+    JsonReport& field(const char* key, const std::string& v)
+    {
+        std::string s = "\"";
+        for (char c : v)
+        {
+            if (c == '"' || c == '\\')
+                s += '\\';
+            s += c;
+        }
+        s += '"';
+
+        return raw(key, s);
+    }
+
+    JsonReport& field(const char* key, const char* v)
+    {
+        return field(key, std::string(v));
+    }
+
+    /// Adds the numeric field \a key to the current record.
+    template<typename T>
+    JsonReport& field(const char* key, T v)
+    {
+        static_assert(std::is_arithmetic<T>::value, "a number is expected");
+
+        std::ostringstream s;
+        if (std::is_integral<T>::value)
+            s << v;
+        else
+            s << std::fixed << double(v);
+
+        return raw(key, s.str());
+    }
+
+    /// Prints the document with all the records to \a out.
+    void print(std::ostream& out) const
+    {
+        out << "{\n  \"suite\": \"dfa_bench\",\n  \"version\": \"0.1.0\",\n"
+            << "  \"compiler\": \"" << __VERSION__ << "\",\n"
+            << "  \"benchmarks\": [\n";
+        for (size_t i = 0; i < _records.size(); ++i)
+        {
+            out << "    {" << _records[i] << '}'
+                << (i + 1 < _records.size() ? ",\n" : "\n");
+        }
+        out << "  ]\n}\n";
+    }
+
+protected:
+    JsonReport& raw(const char* key, const std::string& v)
+    {
+        std::string& rec = _records.back();
+        if (!rec.empty())
+            rec += ", ";
+        rec += '"';
+        rec += key;
+        rec += "\": ";
+        rec += v;
+
+        return *this;
+    }
+
+protected:
+    std::vector<std::string> _records;  ///< Records as lists of fields.
+}; // class JsonReport
+
+
+/// Sizes of DFAs in states.
+const int StatesNums[] = { 10, 1000, 100000, 1000000 };
+
+/// Sizes of alphabets.
+const int AlphabetSizes[] = { 2, 16, 64 };
+
+/// Lengths of replayed sequences.
+const size_t InputLens[] = { 64, 4096, 1 << 20 };
+
+/// Maximum number of transitions of a benchmarked DFA.
+const size_t MaxTransNum = 2000000;
+
+/// Minimum number of symbols replayed for a single measurement.
+const size_t MinReplayed = 1 << 21;
+
+/// Number of lookups for a single measurement.
+const size_t LookupsNum = 1 << 21;
+
+
+/// \return the \a a-th symbol of an alphabet.
+char symbol(int a)
+{
+    return char(' ' + a);
+}
+
+/// Makes transitions of a random complete DFA with \a n states over \a k
+/// symbols; every state is reachable from the state 0 by a cycle through all
+/// the states.
+std::vector<std::tuple<int, char, int>> makeRandomTrans(int n, int k,
+                                                        std::mt19937& rnd)
+{
+    std::vector<std::tuple<int, char, int>> trans;
+    trans.reserve(size_t(n) * k);
+    for (int q = 0; q < n; ++q)
+    {
+        trans.emplace_back(q, symbol(0), (q + 1) % n);
+        for (int a = 1; a < k; ++a)
+            trans.emplace_back(q, symbol(a), int(rnd() % n));
+    }
+
+    return trans;
+}
+
+/// Makes a random sequence of \a len symbols of an alphabet of \a k symbols.
+std::string makeInput(size_t len, int k, std::mt19937& rnd)
+{
+    std::string seq(len, 0);
+    for (char& c : seq)
+        c = symbol(int(rnd() % k));
+
+    return seq;
+}
+
+/// Replays \a seq in the \a player at least MinReplayed symbols in total and
+/// reports the throughput to the \a report.
+template<typename Player>
+void benchPlayer(JsonReport& report, const char* engine, Player& player,
+                 const std::string& seq, int n, int k)
+{
+    size_t reps = (MinReplayed + seq.size() - 1) / seq.size();
+    size_t accepted = 0;
+
+    player.play(std::string_view(seq));             // warm up
+    Stopwatch sw;
+    for (size_t r = 0; r < reps; ++r)
+    {
+        if (player.play(std::string_view(seq)) == Player::Result::Ok)
+            ++accepted;
+    }
+    double ms = sw.ms();
+
+    double symbols = double(reps) * seq.size();
+    report.add("play").field("engine", engine).field("states", n)
+            .field("alphabet", k).field("input_len", seq.size())
+            .field("ns_per_symbol", ms * 1e6 / symbols)
+            .field("gb_per_s", symbols / ms / 1e6)
+            .field("accepted", accepted);
+}
+
+/// Replays \a seq in a player writing a trace to a ring drained by another
+/// thread and reports the throughput and the share of dropped records.
+void benchTracing(JsonReport& report, const IntCharCompiledDfa& cdfa,
+                  const std::string& seq, int n, int k)
+{
+    TraceListener<char>::Ring ring(1 << 16);
+    std::uint64_t consumed = 0;
+    TraceConsumer<char> consumer(ring, [&consumed](const TraceRecord<char>*,
+                                                   size_t num)
+                                       { consumed += num; });
+
+    IntCharTracingDfaPlayer player(cdfa, TraceListener<char>(ring));
+    size_t reps = (MinReplayed + seq.size() - 1) / seq.size();
+    Stopwatch sw;
+    for (size_t r = 0; r < reps; ++r)
+        player.play(std::string_view(seq));
+    double ms = sw.ms();
+    consumer.stop();
+
+    double symbols = double(reps) * seq.size();
+    report.add("play").field("engine", "compiled_traced").field("states", n)
+            .field("alphabet", k).field("input_len", seq.size())
+            .field("ns_per_symbol", ms * 1e6 / symbols)
+            .field("gb_per_s", symbols / ms / 1e6)
+            .field("consumed", consumed)
+            .field("dropped", player.getListener().getDroppedNum());
+}
+
+/// Benchmarks construction, lookups and replays of DFAs of all the sizes.
+void benchEngines(JsonReport& report)
+{
+    std::mt19937 rnd(42);
+    for (int n : StatesNums)
+    {
+        for (int k : AlphabetSizes)
+        {
+            if (size_t(n) * k > MaxTransNum)
+                continue;
+
+            std::vector<std::tuple<int, char, int>> trans =
+                    makeRandomTrans(n, k, rnd);
+
+            // construction by addTrans()
+            IntCharDfa dfa;
+            Stopwatch sw;
+            for (const auto& t : trans)
+                dfa.addTrans(std::get<0>(t), std::get<1>(t), std::get<2>(t));
+            dfa.setInitState(0);
+            for (int q = 0; q < n; q += 3)
+                dfa.addFinState(q);
+            double ms = sw.ms();
+            report.add("construct").field("engine", "map").field("states", n)
+                    .field("alphabet", k)
+                    .field("ns_per_trans", ms * 1e6 / trans.size());
+
+            sw = Stopwatch();
+            IntCharCompiledDfa cdfa(dfa);
+            ms = sw.ms();
+            report.add("construct").field("engine", "compiled")
+                    .field("states", n).field("alphabet", k)
+                    .field("ns_per_trans", ms * 1e6 / trans.size());
+
+            IntCharNfa nfa;
+            nfa.setInitState(0);
+            for (const auto& t : trans)
+                nfa.addTrans(std::get<0>(t), std::get<1>(t), std::get<2>(t));
+            for (int q = 0; q < n; q += 3)
+                nfa.addFinState(q);
+            IntCharLazyDfa ldfa(nfa);
+
+            // lookups of random transitions
+            std::vector<std::pair<int, char>> keys(LookupsNum);
+            for (auto& key : keys)
+                key = { int(rnd() % n), symbol(int(rnd() % k)) };
+
+            long long sum = 0;
+            sw = Stopwatch();
+            for (const auto& key : keys)
+            {
+                int d;
+                if (dfa.getTrans(key.first, key.second, d))
+                    sum += d;
+            }
+            ms = sw.ms();
+            report.add("get_trans").field("engine", "map").field("states", n)
+                    .field("alphabet", k)
+                    .field("ns_per_lookup", ms * 1e6 / keys.size())
+                    .field("checksum", sum);
+
+            sum = 0;
+            sw = Stopwatch();
+            for (const auto& key : keys)
+            {
+                IntCharCompiledDfa::Index c;
+                if (cdfa.getSymbolClass(key.second, c))
+                    sum += cdfa.getTransIndex(IntCharCompiledDfa::Index(key.first), c);
+            }
+            ms = sw.ms();
+            report.add("get_trans").field("engine", "compiled")
+                    .field("states", n).field("alphabet", k)
+                    .field("ns_per_lookup", ms * 1e6 / keys.size())
+                    .field("checksum", sum);
+
+            // replays
+            IntCharDfaPlayer player(dfa);
+            IntCharCompiledDfaPlayer cplayer(cdfa);
+            IntCharBareDfaPlayer bplayer(cdfa);
+            IntCharLazyDfaPlayer lplayer(ldfa);
+            for (size_t len : InputLens)
+            {
+                std::string seq = makeInput(len, k, rnd);
+                benchPlayer(report, "map", player, seq, n, k);
+                benchPlayer(report, "compiled", cplayer, seq, n, k);
+                benchPlayer(report, "compiled_static", bplayer, seq, n, k);
+                benchTracing(report, cdfa, seq, n, k);
+                benchPlayer(report, "lazy", lplayer, seq, n, k);
+            }
+        }
+    }
+}
+
+/// Benchmarks Sheng automata of rows of 16 and 64 bytes against the dense
+/// table on small DFAs.
+void benchSheng(JsonReport& report)
+{
+    std::mt19937 rnd(42);
+    const int k = 16;
+    for (int n : {3, 15, 63})
+    {
+        IntCharDfa dfa;
+        for (const auto& t : makeRandomTrans(n, k, rnd))
+            dfa.addTrans(std::get<0>(t), std::get<1>(t), std::get<2>(t));
+        dfa.setInitState(0);
+        dfa.addFinState(0);
+        IntCharCompiledDfa cdfa(dfa);
+        const std::string seq = makeInput(1 << 20, k, rnd);
+
+        IntCharBareDfaPlayer player(cdfa);
+        benchPlayer(report, "compiled_static", player, seq, n, k);
+        // scalar and SSSE3 replays use narrow rows, VBMI ones wide rows
+        const size_t rowStatesNum = IntCharShengDfa::getRowStatesNum(cdfa);
+        for (SimdLevel level : { SimdLevel::None, SimdLevel::Ssse3,
+                                 SimdLevel::Avx512Vbmi })
+        {
+            bool wide = level == SimdLevel::Avx512Vbmi;
+            if (!isSimdSupported(level) || rowStatesNum > (wide ? 64 : 16)
+                    || (wide && rowStatesNum <= 16))
+                continue;
+
+            IntCharShengDfa sdfa(cdfa, level);
+            IntCharShengDfaPlayer splayer(sdfa);
+            std::string engine = std::string("sheng_") + getSimdName(level);
+            benchPlayer(report, engine.c_str(), splayer, seq, n, k);
+        }
+
+        IntCharAutoDfa adfa(cdfa);
+        IntCharAutoDfaPlayer aplayer(adfa);
+        benchPlayer(report, (adfa.getEngine() == DfaEngine::Sheng)
+                            ? "auto_sheng" : "auto_table",
+                    aplayer, seq, n, k);
+    }
+}
+
+/// Benchmarks stride tables of small alphabets for several size budgets
+/// against the dense table.
+void benchStride(JsonReport& report)
+{
+    std::mt19937 rnd(42);
+    for (int n : {100, 10000})
+    {
+        for (int k : {2, 4})
+        {
+            IntCharDfa dfa;
+            for (const auto& t : makeRandomTrans(n, k, rnd))
+                dfa.addTrans(std::get<0>(t), std::get<1>(t), std::get<2>(t));
+            dfa.setInitState(0);
+            dfa.addFinState(0);
+            IntCharCompiledDfa cdfa(dfa);
+            const std::string seq = makeInput(1 << 20, k, rnd);
+
+            IntCharBareDfaPlayer player(cdfa);
+            benchPlayer(report, "compiled_static", player, seq, n, k);
+            for (size_t budget : {size_t(1) << 16, size_t(1) << 20,
+                                  size_t(1) << 24})
+            {
+                IntCharStrideDfa sdfa(cdfa, budget);
+                IntCharStrideDfaPlayer splayer(sdfa);
+                std::string engine = "stride" +
+                        std::to_string(sdfa.getStride()) + "_" +
+                        std::to_string(sdfa.getTableSize() >> 10) + "k";
+                benchPlayer(report, engine.c_str(), splayer, seq, n, k);
+            }
+        }
+    }
+}
+
+/// Benchmarks skipping of self-loops on lines with comments of several
+/// lengths against the dense table and Sheng.
+void benchAccel(JsonReport& report)
+{
+    IntCharDfa dfa = RegexCompiler::compile("([a-z ]*(#.*)?\n)*");
+    IntCharCompiledDfa cdfa(dfa);
+    IntCharAccelDfa adfa(cdfa);
+    const int n = int(cdfa.getStatesNum());
+    for (int commentLen : {4, 64, 1024})
+    {
+        std::string seq;
+        while (seq.size() < (1 << 20))
+            seq += "some words #" + std::string(commentLen, '-') + "\n";
+
+        IntCharBareDfaPlayer player(cdfa);
+        IntCharAccelDfaPlayer aplayer(adfa);
+        std::string suffix = "_comment" + std::to_string(commentLen);
+        benchPlayer(report, ("compiled_static" + suffix).c_str(), player, seq,
+                    n, 256);
+        if (IntCharShengDfa::isApplicable(cdfa))
+        {
+            IntCharShengDfa sdfa(cdfa);
+            IntCharShengDfaPlayer splayer(sdfa);
+            benchPlayer(report, ("sheng" + suffix).c_str(), splayer, seq, n,
+                        256);
+        }
+        benchPlayer(report, ("accel" + suffix).c_str(), aplayer, seq, n, 256);
+    }
+}
+
+/// Benchmarks early stops in states of certain fates on inputs reaching such
+/// a state at once and never against the dense table.
+void benchFates(JsonReport& report)
+{
+    IntCharDfa dfa = RegexCompiler::compile("[a-z]*(#(.|\n)*)?");
+    IntCharCompiledDfa cdfa(dfa);
+    IntCharCompiledDfa::Fates fates = cdfa.getFates();
+    const int n = int(cdfa.getStatesNum());
+    std::mt19937 rnd(42);
+    for (const char* prefix : {"header#", ""})
+    {
+        std::string seq = prefix;
+        while (seq.size() < (1 << 20))
+            seq += char('a' + rnd() % 26);
+
+        IntCharBareDfaPlayer player(cdfa);
+        IntCharBareDfaPlayer fplayer(cdfa);
+        fplayer.setFates(&fates);
+        std::string suffix = *prefix ? "_decided" : "_open";
+        benchPlayer(report, ("compiled_static" + suffix).c_str(), player, seq,
+                    n, 256);
+        benchPlayer(report, ("compiled_fates" + suffix).c_str(), fplayer, seq,
+                    n, 256);
+    }
+}
+
+/// Benchmarks interleaved replays of many sequences with every supported
+/// instruction set against replays one by one.
+void benchStreams(JsonReport& report)
+{
+    const int k = 16;
+    std::mt19937 rnd(42);
+    for (int n : {1000, 1000000})
+    {
+        IntCharDfa dfa;
+        for (const auto& t : makeRandomTrans(n, k, rnd))
+            dfa.addTrans(std::get<0>(t), std::get<1>(t), std::get<2>(t));
+        dfa.setInitState(0);
+        dfa.addFinState(0);
+        IntCharCompiledDfa cdfa(dfa);
+
+        const size_t seqsNum = 4096;
+        std::vector<std::string> strs(seqsNum);
+        size_t symbols = 0;
+        for (std::string& s : strs)
+        {
+            s = makeInput(1024 + rnd() % 1024, k, rnd);
+            symbols += s.size();
+        }
+        std::vector<std::string_view> seqs(strs.begin(), strs.end());
+
+        const int reps = 5;
+        IntCharBareDfaPlayer player(cdfa);
+        size_t accepted = 0;
+        Stopwatch sw;
+        for (int r = 0; r < reps; ++r)
+        {
+            for (std::string_view seq : seqs)
+                accepted += (player.play(seq) == PlayResult::Ok);
+        }
+        double baseMs = sw.ms() / reps;
+        report.add("play_streams").field("engine", "sequential")
+                .field("states", n).field("alphabet", k)
+                .field("ns_per_symbol", baseMs * 1e6 / double(symbols))
+                .field("speedup", 1.0).field("accepted", accepted / reps);
+
+        std::vector<IntCharMultiStreamDfaPlayer::StreamResult> results(seqsNum);
+        for (SimdLevel level : { SimdLevel::None, SimdLevel::Avx2,
+                                 SimdLevel::Avx512 })
+        {
+            IntCharMultiStreamDfaPlayer mplayer(cdfa, level);
+            if (mplayer.getSimdLevel() != level)
+                continue;
+
+            accepted = 0;
+            sw = Stopwatch();
+            for (int r = 0; r < reps; ++r)
+            {
+                mplayer.playStreams(seqs.data(), seqsNum, results.data());
+                for (const auto& res : results)
+                    accepted += (res.result == PlayResult::Ok);
+            }
+            double ms = sw.ms() / reps;
+            report.add("play_streams").field("engine", getSimdName(level))
+                    .field("states", n).field("alphabet", k)
+                    .field("ns_per_symbol", ms * 1e6 / double(symbols))
+                    .field("speedup", baseMs / ms)
+                    .field("accepted", accepted / reps);
+        }
+    }
+}
+
+/// Benchmarks batch replays of many short sequences of uneven lengths on
+/// pools of 1, 2, 4... threads up to the number of hardware threads.
+void benchBatch(JsonReport& report)
+{
+    const int n = 1000;
+    const int k = 16;
+    std::mt19937 rnd(42);
+    IntCharDfa dfa;
+    for (const auto& t : makeRandomTrans(n, k, rnd))
+        dfa.addTrans(std::get<0>(t), std::get<1>(t), std::get<2>(t));
+    dfa.setInitState(0);
+    dfa.addFinState(0);
+    IntCharSharedDfa sdfa(dfa);
+
+    const size_t seqsNum = 100000;
+    std::vector<std::string> strs(seqsNum);
+    size_t symbols = 0;
+    for (std::string& s : strs)
+    {
+        s = makeInput(8 + rnd() % 249, k, rnd);
+        symbols += s.size();
+    }
+    std::vector<std::string_view> seqs(strs.begin(), strs.end());
+    std::vector<PlayResult> results(seqsNum);
+
+    size_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    double baseMs = 0;
+    for (size_t threadsNum = 1; threadsNum <= maxThreads; threadsNum *= 2)
+    {
+        WorkStealingPool pool(threadsNum);
+        IntCharBatchDfaPlayer batch(sdfa, pool);
+        batch.playBatch(seqs.data(), seqs.size(), results.data());  // warm-up
+
+        const int reps = 10;
+        Stopwatch sw;
+        for (int r = 0; r < reps; ++r)
+            batch.playBatch(seqs.data(), seqs.size(), results.data());
+        double ms = sw.ms() / reps;
+        if (threadsNum == 1)
+            baseMs = ms;
+
+        report.add("play_batch").field("threads", threadsNum)
+                .field("states", n).field("alphabet", k)
+                .field("sequences", seqsNum)
+                .field("ns_per_symbol", ms * 1e6 / double(symbols))
+                .field("gb_per_s", double(symbols) / ms / 1e6)
+                .field("speedup", baseMs / ms);
+    }
+}
+
+/// Benchmarks parallel replays of a single long sequence on pools of 1, 2,
+/// 4... threads up to the number of hardware threads.
+void benchParallel(JsonReport& report)
+{
+    const int k = 16;
+    std::mt19937 rnd(42);
+    for (int n : {4, 32})
+    {
+        IntCharDfa dfa;
+        for (const auto& t : makeRandomTrans(n, k, rnd))
+            dfa.addTrans(std::get<0>(t), std::get<1>(t), std::get<2>(t));
+        dfa.setInitState(0);
+        dfa.addFinState(0);
+        IntCharSharedDfa sdfa(dfa);
+
+        const std::string seq = makeInput(size_t(1) << 26, k, rnd);
+
+        size_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+        double baseMs = 0;
+        for (size_t threadsNum = 1; threadsNum <= maxThreads; threadsNum *= 2)
+        {
+            WorkStealingPool pool(threadsNum);
+            IntCharParallelDfaPlayer player(sdfa, pool);
+            player.play(seq.data(), seq.size());                // warm-up
+
+            const int reps = 3;
+            std::uint64_t checksum = 0;
+            Stopwatch sw;
+            for (int r = 0; r < reps; ++r)
+            {
+                player.play(seq.data(), seq.size());
+                checksum += player.getCurPos() + player.getCurIndex();
+            }
+            double ms = sw.ms() / reps;
+            if (threadsNum == 1)
+                baseMs = ms;
+
+            report.add("play_parallel").field("threads", threadsNum)
+                    .field("states", n).field("alphabet", k)
+                    .field("symbols", seq.size())
+                    .field("ns_per_symbol", ms * 1e6 / double(seq.size()))
+                    .field("gb_per_s", double(seq.size()) / ms / 1e6)
+                    .field("speedup", baseMs / ms)
+                    .field("checksum", checksum);
+        }
+    }
+}
+
+/// Benchmarks the initializer-list constructor on a small literal DFA.
+void benchInitList(JsonReport& report)
+{
+    const int reps = 100000;
+    size_t states = 0;
+
+    Stopwatch sw;
+    for (int r = 0; r < reps; ++r)
+    {
+        IntCharDfa dfa{0,
+                       { {0, 'a', 1}, {0, 'b', 0}, {0, 'c', 3},
+                         {1, 'a', 1}, {1, 'b', 2}, {1, 'c', 3},
+                         {2, 'a', 2}, {2, 'b', 2}, {2, 'c', 0},
+                         {3, 'a', 0}, {3, 'b', 1}, {3, 'c', 2}
+                       },
+                       { 2, 3 }
+                      };
+        states += dfa.getStatesNum();
+    }
+    double ms = sw.ms();
+
+    report.add("construct_init_list").field("engine", "map")
+            .field("states", 4).field("alphabet", 3)
+            .field("ns_per_dfa", ms * 1e6 / reps)
+            .field("ns_per_trans", ms * 1e6 / reps / 12)
+            .field("checksum", states);
+}
+
+/// Benchmarks saving and loading of binary images.
+void benchImage(JsonReport& report)
+{
+    std::mt19937 rnd(42);
+    const std::string path = "dfa_bench_image.bin";
+    for (int n : {1000, 1000000})
+    {
+        IntCharDfa dfa;
+        for (const auto& t : makeRandomTrans(n, 2, rnd))
+            dfa.addTrans(std::get<0>(t), std::get<1>(t), std::get<2>(t));
+        dfa.setInitState(0);
+        IntCharCompiledDfa cdfa(dfa);
+
+        Stopwatch sw;
+        IntCharDfaImage::save(cdfa, path);
+        double saveMs = sw.ms();
+
+        sw = Stopwatch();
+        IntCharCompiledDfa loaded = IntCharDfaImage::load(path);
+        double loadMs = sw.ms();
+
+        sw = Stopwatch();
+        IntCharCompiledDfa mapped = IntCharDfaImage::load(path, false);
+        double mapMs = sw.ms();
+
+        report.add("image").field("states", n).field("alphabet", 2)
+                .field("save_ms", saveMs).field("load_verified_ms", loadMs)
+                .field("load_unverified_ms", mapMs);
+    }
+    std::remove(path.c_str());
+}
+
+/// Makes a complete DFA with \a n states over \a k symbols, which is an
+/// unfolding of a random DFA with \a m states: every state is a copy of one of
+/// the base states, so the minimal DFA has at most \a m states.
+IntCharDfa makeUnfoldedDfa(int n, int m, int k, std::mt19937& rnd)
+{
+    std::vector<int> base(m * k);
+    for (int& d : base)
+        d = int(rnd() % m);
+
+    IntCharDfa dfa;
+    dfa.addState(0);
+    for (int q = 0; q < n; ++q)
+    {
+        for (int a = 0; a < k; ++a)
+        {
+            int d = base[(q % m) * k + a] + m * int(rnd() % (n / m));
+            dfa.addTrans(q, char('a' + a), d);
+        }
+        if (q % m % 3 == 0)
+            dfa.addFinState(q);
+    }
+
+    return dfa;
+}
+
+void benchMinimize(JsonReport& report)
+{
+    std::mt19937 rnd(42);
+    for (int n : {100000, 300000, 1000000})
+    {
+        IntCharDfa dfa = makeUnfoldedDfa(n, 1000, 2, rnd);
+
+        Stopwatch sw;
+        IntCharDfa min = dfa.minimize();
+        double ms = sw.ms();
+
+        report.add("minimize").field("states", n)
+                .field("transitions", dfa.getTransNum())
+                .field("min_states", min.getStatesNum())
+                .field("time_ms", ms);
+    }
+}
+
+/// Makes an NFA for the union of \a n random words of the length \a len,
+/// each one hanging on an eps-transition from the init state.
+IntCharNfa makeWordsNfa(int n, int len, std::mt19937& rnd)
+{
+    IntCharNfa nfa;
+    nfa.setInitState(0);
+    int next = 1;
+    for (int w = 0; w < n; ++w)
+    {
+        nfa.addEpsTrans(0, next);
+        for (int i = 0; i < len; ++i, ++next)
+            nfa.addTrans(next, char('a' + rnd() % 26), next + 1);
+        nfa.addFinState(next++);
+    }
+
+    return nfa;
+}
+
+void benchDeterminize(JsonReport& report)
+{
+    std::mt19937 rnd(42);
+    for (int n : {100, 1000, 5000})
+    {
+        IntCharNfa nfa = makeWordsNfa(n, 8, rnd);
+
+        Stopwatch sw;
+        IntCharDfa dfa = nfa.determinize();
+        double ms = sw.ms();
+
+        report.add("determinize").field("nfa_states", nfa.getStatesNum())
+                .field("dfa_states", dfa.getStatesNum())
+                .field("time_ms", ms);
+    }
+}
+
+void benchRegex(JsonReport& report)
+{
+    std::mt19937 rnd(42);
+
+    // alternations of words, as in rule sets
+    for (int n : {10, 100, 1000})
+    {
+        std::string re;
+        for (int w = 0; w < n; ++w)
+        {
+            if (w)
+                re += '|';
+            for (int i = 0; i < 8; ++i)
+                re += char('a' + rnd() % 26);
+        }
+
+        Stopwatch sw;
+        IntCharDfa dfa = RegexCompiler::compile(re);
+        double ms = sw.ms();
+
+        report.add("regex_compile").field("kind", "words")
+                .field("pattern_len", re.size())
+                .field("dfa_states", dfa.getStatesNum())
+                .field("time_ms", ms);
+    }
+
+    // field-like patterns with classes and bounded repetitions
+    for (int n : {1, 4, 16})
+    {
+        std::string re;
+        for (int i = 0; i < n; ++i)
+            re += "[a-zA-Z_][\\w.-]{0,15}=\\d{1,6};";
+
+        Stopwatch sw;
+        IntCharDfa dfa = RegexCompiler::compile(re);
+        double ms = sw.ms();
+
+        report.add("regex_compile").field("kind", "fields")
+                .field("pattern_len", re.size())
+                .field("dfa_states", dfa.getStatesNum())
+                .field("time_ms", ms);
+    }
+}
+
+int main()
+{
+    JsonReport report;
+
+    benchEngines(report);
+    benchSheng(report);
+    benchStride(report);
+    benchAccel(report);
+    benchFates(report);
+    benchStreams(report);
+    benchBatch(report);
+    benchParallel(report);
+    benchInitList(report);
+    benchImage(report);
+    benchMinimize(report);
+    benchDeterminize(report);
+    benchRegex(report);
+
+    report.print(std::cout);
+
+    return 0;
+}
@@ -0,0 +1,390 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains declarations of the types for DFAs skipping self-loops
+///             by scanning for exit symbols.
+/// \author     DFA library contributors
+/// \version    0.1.0
+/// \date       16.10.2026
+/// \copyright  © DFA library contributors 2026.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef ACCEL_DFA_HPP_
+#define ACCEL_DFA_HPP_
+
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+#include "compiled_dfa.hpp"
+#include "simd.hpp"
+
+
+
+/*! ****************************************************************************
+ *  \brief AccelDfa is a compiled DFA of byte symbols that knows which of its
+ *  states can be left by a few symbols only.
+ *
+ *  The exit symbols of a state are the ones that lead to another state,
+ *  miss a transition or are unknown; a state is accelerable if it has at
+ *  most MaxExitsNum of them, so it loops on all the other bytes. A player
+ *  in such a state skips the run of looping symbols by scanning for
+ *  the nearest exit symbol: by `memchr` for a single exit and by SSE2
+ *  comparisons of 16 bytes at once for more. A state without exits is
+ *  never left, so the rest of a sequence is skipped at once. The CompiledDfa
+ *  is referred to, not copied, so it must outlive the automaton, as it must
+ *  outlive its players.
+ *
+ *  \tparam State is a data type for representing states.
+ *  \tparam Alpha represent elements of the alphabet of an automaton.
+ ******************************************************************************/
+template<typename State, typename Alpha>
+class AccelDfa {
+public:
+    // aliases for State and Alpha
+    typedef State TState;
+    typedef Alpha TAlpha;
+
+    /// Specified compiled DFA.
+    typedef CompiledDfa<State, Alpha> SpecCompiledDfa;
+
+    /// Index type of the compiled DFA.
+    typedef typename SpecCompiledDfa::Index Index;
+
+    /// Maximum number of exit symbols of an accelerable state.
+    static constexpr size_t MaxExitsNum = 4;
+
+    /// Symbols are bytes, which can be scanned for.
+    static constexpr bool IsByteAlpha = SpecCompiledDfa::HasClassTable
+                                        && sizeof(Alpha) == 1;
+
+public:
+    // Constructors and all.
+
+    /// Finds the accelerable states of \a dfa.
+    explicit AccelDfa(const SpecCompiledDfa& dfa)
+        : _dfa(dfa)
+        , _exitsNums(dfa.getStatesNum(), NotAccel)
+        , _exits(dfa.getStatesNum() * MaxExitsNum)
+        , _accelNum(0)
+        , _scanNum(0)
+    {
+        if constexpr (IsByteAlpha)
+        {
+            for (Index s = 0; s < dfa.getStatesNum(); ++s)
+            {
+                std::uint8_t n = findExits(dfa, s, &_exits[s * MaxExitsNum]);
+                _exitsNums[s] = n;
+                if (n != NotAccel)
+                    ++_accelNum;
+                if (n != NotAccel && n != 0)
+                    ++_scanNum;
+            }
+        }
+    }
+
+    /// The compiled automaton is referred to, so it cannot be a temporary.
+    explicit AccelDfa(const SpecCompiledDfa&& dfa) = delete;
+
+public:
+
+    /// \return true if some state of \a dfa is accelerable.
+    static bool isApplicable(const SpecCompiledDfa& dfa)
+    {
+        if constexpr (IsByteAlpha)
+        {
+            Alpha exits[MaxExitsNum];
+            for (Index s = 0; s < dfa.getStatesNum(); ++s)
+            {
+                if (findExits(dfa, s, exits) != NotAccel)
+                    return true;
+            }
+        }
+
+        return false;
+    }
+
+    /// \return the compiled automaton.
+    const SpecCompiledDfa& getCompiledDfa() const { return _dfa; }
+
+    /// \return number of accelerable states.
+    size_t getAccelStatesNum() const { return _accelNum; }
+
+    /// \return number of accelerable states that have exits, so are left
+    /// after a scan, unlike sinks.
+    size_t getScanStatesNum() const { return _scanNum; }
+
+    /// \return true if the state \a s is accelerable.
+    bool isAccel(Index s) const { return _exitsNums[s] != NotAccel; }
+
+    /// \return number of exit symbols of the accelerable state \a s.
+    size_t getExitsNum(Index s) const { return _exitsNums[s]; }
+
+    /// \return exit symbols of the accelerable state \a s.
+    const Alpha* getExits(Index s) const
+    {
+        return _exits.data() + s * MaxExitsNum;
+    }
+
+    /// \return position of the first exit symbol of the accelerable state
+    /// \a s in [\a pos, \a len) of \a seq, or \a len if there is none.
+    size_t findExit(Index s, const Alpha* seq, size_t pos, size_t len) const
+    {
+        if constexpr (!IsByteAlpha)
+            return pos;
+        else
+        {
+            const Alpha* exits = getExits(s);
+            const size_t n = _exitsNums[s];
+            if (n == 0)
+                return len;
+            if (n == 1)
+            {
+                const void* p = std::memchr(seq + pos, std::uint8_t(exits[0]),
+                                            len - pos);
+                return p ? static_cast<const Alpha*>(p) - seq : len;
+            }
+
+#if FSA_X86_SIMD
+            return findExitSse2(exits, n, seq, pos, len);
+#else
+            for ( ; pos < len; ++pos)
+            {
+                if (std::find(exits, exits + n, seq[pos]) != exits + n)
+                    break;
+            }
+
+            return pos;
+#endif
+        }
+    }
+
+protected:
+    /// Number of exits of a state that is not accelerable.
+    static constexpr std::uint8_t NotAccel = 0xff;
+
+protected:
+    /// Collects the exit symbols of the state \a s of \a dfa to \a exits,
+    /// if there are few.
+    /// \return number of the exits, or NotAccel if there are too many.
+    static std::uint8_t findExits(const SpecCompiledDfa& dfa, Index s,
+                                  Alpha* exits)
+    {
+        size_t n = 0;
+        for (unsigned v = 0; v < 256; ++v)
+        {
+            Alpha a = Alpha(v);
+            Index c;
+            if (dfa.getSymbolClass(a, c) && dfa.getTransIndex(s, c) == s)
+                continue;
+            if (n == MaxExitsNum)
+                return NotAccel;
+            exits[n++] = a;
+        }
+
+        return std::uint8_t(n);
+    }
+
+#if FSA_X86_SIMD
+    /// Finds the first of \a n exits of \a exits by SSE2 comparisons.
+    __attribute__((target("sse2")))
+    static size_t findExitSse2(const Alpha* exits, size_t n, const Alpha* seq,
+                               size_t pos, size_t len)
+    {
+        __m128i e[MaxExitsNum];
+        for (size_t i = 0; i < MaxExitsNum; ++i)
+            e[i] = _mm_set1_epi8(char(exits[i < n ? i : 0]));
+
+        for ( ; pos + 16 <= len; pos += 16)
+        {
+            __m128i v = _mm_loadu_si128(
+                        reinterpret_cast<const __m128i*>(seq + pos));
+            __m128i m = _mm_or_si128(
+                    _mm_or_si128(_mm_cmpeq_epi8(v, e[0]),
+                                 _mm_cmpeq_epi8(v, e[1])),
+                    _mm_or_si128(_mm_cmpeq_epi8(v, e[2]),
+                                 _mm_cmpeq_epi8(v, e[3])));
+            int mask = _mm_movemask_epi8(m);
+            if (mask != 0)
+                return pos + __builtin_ctz(unsigned(mask));
+        }
+
+        for ( ; pos < len; ++pos)
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                if (seq[pos] == exits[i])
+                    return pos;
+            }
+        }
+
+        return len;
+    }
+#endif
+
+protected:
+    const SpecCompiledDfa& _dfa;        ///< Ref to the compiled automaton.
+
+    /// Numbers of exits of states, NotAccel if a state is not accelerable.
+    std::vector<std::uint8_t> _exitsNums;
+
+    std::vector<Alpha> _exits;          ///< Exits of states, MaxExitsNum each.
+    size_t _accelNum;                   ///< Number of accelerable states.
+    size_t _scanNum;                    ///< Number of them having exits.
+}; // class AccelDfa
+
+
+template<typename State, typename Alpha>
+constexpr size_t AccelDfa<State, Alpha>::MaxExitsNum;
+
+template<typename State, typename Alpha>
+constexpr bool AccelDfa<State, Alpha>::IsByteAlpha;
+
+template<typename State, typename Alpha>
+constexpr std::uint8_t AccelDfa<State, Alpha>::NotAccel;
+
+
+/*! ****************************************************************************
+ *  \brief Player used to replay a given string in an AccelDfa.
+ *
+ *  Provides the same semantics as BasicCompiledDfaPlayer with NullListener
+ *  does. Steps are made by the dense table, and runs of looping symbols in
+ *  accelerable states are skipped by scans.
+ *
+ *  \tparam State is a data type for representing states.
+ *  \tparam Alpha represent elements of the alphabet of an automaton.
+ ******************************************************************************/
+template<typename State, typename Alpha>
+class AccelDfaPlayer {
+public:
+    // aliases for State and Alpha
+    typedef State TState;
+    typedef Alpha TAlpha;
+
+    /// Specified accelerated DFA.
+    typedef AccelDfa<State, Alpha> SpecAccelDfa;
+
+    /// Specified compiled DFA.
+    typedef typename SpecAccelDfa::SpecCompiledDfa SpecCompiledDfa;
+
+    /// Index type of the compiled DFA.
+    typedef typename SpecAccelDfa::Index Index;
+
+    /// Results of replaying (shared with DfaPlayer).
+    typedef PlayResult Result;
+
+public:
+    // Constructors and all.
+
+    /// Inititalizes a player with an automaton.
+    explicit AccelDfaPlayer(const SpecAccelDfa& dfa)
+        : _dfa(dfa)
+        , _curState(dfa.getCompiledDfa().getInitIndex())
+        , _curPos(0)
+        , _lastSymb(Alpha())
+    {
+    }
+
+public:
+
+    /// Plays a sequence of \a len symbols stored at \a seq.
+    /// \return the same result as BasicCompiledDfaPlayer::play() does.
+    Result play(const Alpha* seq, size_t len)
+    {
+        const SpecCompiledDfa& cdfa = _dfa.getCompiledDfa();
+        Index s = cdfa.getInitIndex();
+
+        // starts over as BasicCompiledDfaPlayer::init() does
+        _curState = s;
+        _curPos = 0;
+        _lastSymb = Alpha();
+        size_t pos = 0;
+        while (pos < len)
+        {
+            // the symbol at pos leaves an accelerable state, if any
+            if (_dfa.isAccel(s))
+            {
+                pos = _dfa.findExit(s, seq, pos, len);
+                if (pos == len)
+                    break;
+            }
+
+            for ( ; pos < len; ++pos)
+            {
+                Alpha a = seq[pos];
+                Index c;
+                Index d = SpecCompiledDfa::NoTrans;
+                if (cdfa.getSymbolClass(a, c))
+                    d = cdfa.getTransIndex(s, c);
+                if (d == SpecCompiledDfa::NoTrans)
+                {
+                    _curState = s;
+                    _curPos = pos;
+                    _lastSymb = a;
+                    return Result::NoTrans;
+                }
+
+                s = d;
+                if (_dfa.isAccel(s))
+                {
+                    ++pos;
+                    break;
+                }
+            }
+        }
+
+        _curState = s;
+        _curPos = len;
+        if (len != 0)
+            _lastSymb = seq[len - 1];
+
+        return cdfa.isFinIndex(s) ? Result::Ok : Result::NonFinState;
+    }
+
+    /// Plays a sequence provided as a string view.
+    template<typename Traits>
+    Result play(std::basic_string_view<Alpha, Traits> seq)
+    {
+        return play(seq.data(), seq.size());
+    }
+
+    /// Plays a sequence provided as a vector.
+    Result play(const std::vector<Alpha>& seq)
+    {
+        return play(seq.data(), seq.size());
+    }
+
+    /// Returns state being visited.
+    State getCurState() const
+    {
+        return _dfa.getCompiledDfa().getState(_curState);
+    }
+
+    /// Returns index of the state being visited.
+    Index getCurIndex() const { return _curState; }
+
+    /// Returns current position in the replayed sequence.
+    std::uint64_t getCurPos() const { return _curPos; }
+
+    /// Returns the last considered symbol.
+    Alpha getLastSymbol() const { return _lastSymb; }
+
+protected:
+    const SpecAccelDfa& _dfa;           ///< Ref to the automaton.
+    Index _curState;                    ///< Index of the current state.
+    std::uint64_t _curPos;              ///< Currently replayed symbol.
+    Alpha _lastSymb;                    ///< Stores last replayed symbol.
+}; // class AccelDfaPlayer
+
+
+
+#endif // ACCEL_DFA_HPP_
@@ -0,0 +1,332 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains declarations of the types for DFAs compiled to
+///             the engine that suits them best.
+/// \author     DFA library contributors
+/// \version    0.1.0
+/// \date       16.10.2026
+/// \copyright  © DFA library contributors 2026.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef AUTO_DFA_HPP_
+#define AUTO_DFA_HPP_
+
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "accel_dfa.hpp"
+#include "compiled_dfa.hpp"
+#include "sheng_dfa.hpp"
+#include "stride_dfa.hpp"
+
+
+
+/// Engines replaying compiled DFAs.
+enum class DfaEngine {
+    Table,                              ///< Dense table, see CompiledDfa.
+    Sheng,                              ///< Byte shuffles, see ShengDfa.
+    Stride,                             ///< Multi-symbol steps, see StrideDfa.
+    Accel,                              ///< Scans of self-loops, see AccelDfa.
+}; // enum class DfaEngine
+
+
+/*! ****************************************************************************
+ *  \brief AutoDfa compiles a Dfa to an engine chosen by its shape.
+ *
+ *  An automaton is always frozen into a CompiledDfa, which is shared by
+ *  the engines and by copies of the AutoDfa. If it has few enough states
+ *  for the shuffles the CPU supports (see ShengDfa::isApplicable()), it is
+ *  compiled to a ShengDfa, whose steps take the same time whatever the
+ *  input. Otherwise, if some of its states loop on all the bytes but
+ *  a few exits, it is compiled to an AccelDfa, which skips runs of such
+ *  loops at memory bandwidth; sinks without exits do not count, as the
+ *  dense table stops in them as well. Otherwise, if a size budget for
+ *  multi-stride tables is given and a table of a stride of at least 2 fits
+ *  it, the automaton is compiled to a StrideDfa. Otherwise it is replayed
+ *  by the dense table, which stops early in states of certain fates, if
+ *  there are any (see CompiledDfa::getFates()).
+ *
+ *  Sheng is preferred to scans, as a scan pays for a call per run, so scans
+ *  win on long runs only, which the shape of an automaton does not tell
+ *  (see benchAccel() of dfa_bench).
+ *
+ *  \tparam State is a data type for representing states.
+ *  \tparam Alpha represent elements of the alphabet of an automaton.
+ ******************************************************************************/
+template<typename State, typename Alpha>
+class AutoDfa {
+public:
+    // aliases for State and Alpha
+    typedef State TState;
+    typedef Alpha TAlpha;
+
+    /// Specified compiled DFA.
+    typedef CompiledDfa<State, Alpha> SpecCompiledDfa;
+
+    /// Specified Sheng DFA.
+    typedef ShengDfa<State, Alpha> SpecShengDfa;
+
+    /// Specified stride DFA.
+    typedef StrideDfa<State, Alpha> SpecStrideDfa;
+
+    /// Specified accelerated DFA.
+    typedef AccelDfa<State, Alpha> SpecAccelDfa;
+
+    /// Fates of states.
+    typedef typename SpecCompiledDfa::Fates Fates;
+
+public:
+    // Constructors and all.
+
+    /// Compiles the automaton \a dfa.
+    explicit AutoDfa(const Dfa<State, Alpha>& dfa)
+        : AutoDfa(SpecCompiledDfa(dfa))
+    {
+    }
+
+    /// Takes over the compiled automaton \a dfa, e.g. loaded from an image,
+    /// and chooses an engine for it among the ones allowed by \a level and
+    /// the size budget \a strideBudget of a stride table in bytes, zero for
+    /// no stride tables.
+    explicit AutoDfa(SpecCompiledDfa dfa, SimdLevel level = detectSimdLevel(),
+                     size_t strideBudget = 0)
+        : _dfa(std::make_shared<const SpecCompiledDfa>(std::move(dfa)))
+    {
+        // the engines refer to the shared compiled automaton
+        const SpecCompiledDfa& cdfa = *_dfa;
+        if (SpecShengDfa::isApplicable(cdfa, level))
+        {
+            _sheng.reset(new SpecShengDfa(cdfa, level));
+            return;
+        }
+
+        // sinks alone are no reason for scans, the table stops in them too
+        std::shared_ptr<const SpecAccelDfa> accel(new SpecAccelDfa(cdfa));
+        if (accel->getScanStatesNum() != 0)
+        {
+            _accel = accel;
+            return;
+        }
+
+        if (SpecStrideDfa::chooseStride(cdfa, strideBudget) > 1)
+        {
+            _stride.reset(new SpecStrideDfa(cdfa, strideBudget));
+            return;
+        }
+
+        Fates fates = cdfa.getFates();
+        if (std::find_if(fates.begin(), fates.end(), [](StateFate f)
+                         { return f != StateFate::Open; }) != fates.end())
+            _fates = std::move(fates);
+    }
+
+public:
+
+    /// \return engine the automaton is replayed by.
+    DfaEngine getEngine() const
+    {
+        if (_accel)
+            return DfaEngine::Accel;
+        if (_sheng)
+            return DfaEngine::Sheng;
+
+        return _stride ? DfaEngine::Stride : DfaEngine::Table;
+    }
+
+    /// \return the compiled automaton.
+    const SpecCompiledDfa& getCompiledDfa() const { return *_dfa; }
+
+    /// \return the Sheng automaton, or null if it is not used.
+    const SpecShengDfa* getShengDfa() const { return _sheng.get(); }
+
+    /// \return the stride automaton, or null if it is not used.
+    const SpecStrideDfa* getStrideDfa() const { return _stride.get(); }
+
+    /// \return the accelerated automaton, or null if it is not used.
+    const SpecAccelDfa* getAccelDfa() const { return _accel.get(); }
+
+    /// \return fates of states the table is replayed with, or null if they
+    /// are not used.
+    const Fates* getFates() const { return _fates.empty() ? nullptr : &_fates; }
+
+protected:
+    /// Compiled automaton the engines refer to.
+    std::shared_ptr<const SpecCompiledDfa> _dfa;
+
+    /// Shuffle-based automaton, if it suits.
+    std::shared_ptr<const SpecShengDfa> _sheng;
+
+    /// Multi-stride automaton, if it suits.
+    std::shared_ptr<const SpecStrideDfa> _stride;
+
+    /// Automaton accelerating self-loops, if it suits.
+    std::shared_ptr<const SpecAccelDfa> _accel;
+
+    Fates _fates;                       ///< Fates of states, if used.
+}; // class AutoDfa
+
+
+/*! ****************************************************************************
+ *  \brief Player used to replay a given string in an AutoDfa by its engine.
+ *
+ *  Provides the same semantics as BasicCompiledDfaPlayer with NullListener
+ *  does.
+ *
+ *  \tparam State is a data type for representing states.
+ *  \tparam Alpha represent elements of the alphabet of an automaton.
+ ******************************************************************************/
+template<typename State, typename Alpha>
+class AutoDfaPlayer {
+public:
+    // aliases for State and Alpha
+    typedef State TState;
+    typedef Alpha TAlpha;
+
+    /// Specified automaton.
+    typedef AutoDfa<State, Alpha> SpecAutoDfa;
+
+    /// Index type of the compiled DFA.
+    typedef typename SpecAutoDfa::SpecCompiledDfa::Index Index;
+
+    /// Results of replaying (shared with DfaPlayer).
+    typedef PlayResult Result;
+
+public:
+    // Constructors and all.
+
+    /// Inititalizes a player with an automaton.
+    explicit AutoDfaPlayer(const SpecAutoDfa& dfa)
+        : _dfa(dfa)
+        , _tablePlayer(dfa.getCompiledDfa())
+    {
+        _tablePlayer.setFates(dfa.getFates());
+        if (dfa.getShengDfa())
+            _shengPlayer.reset(new ShengPlayer(*dfa.getShengDfa()));
+        if (dfa.getStrideDfa())
+            _stridePlayer.reset(new StridePlayer(*dfa.getStrideDfa()));
+        if (dfa.getAccelDfa())
+            _accelPlayer.reset(new AccelPlayer(*dfa.getAccelDfa()));
+    }
+
+public:
+
+    /// Plays a sequence of \a len symbols stored at \a seq.
+    /// \return the same result as BasicCompiledDfaPlayer::play() does.
+    Result play(const Alpha* seq, size_t len)
+    {
+        if (_accelPlayer)
+            return _accelPlayer->play(seq, len);
+        if (_shengPlayer)
+            return _shengPlayer->play(seq, len);
+        if (_stridePlayer)
+            return _stridePlayer->play(seq, len);
+
+        return _tablePlayer.play(seq, len);
+    }
+
+    /// Plays a sequence provided as a string view.
+    template<typename Traits>
+    Result play(std::basic_string_view<Alpha, Traits> seq)
+    {
+        return play(seq.data(), seq.size());
+    }
+
+    /// Plays a sequence provided as a vector.
+    Result play(const std::vector<Alpha>& seq)
+    {
+        return play(seq.data(), seq.size());
+    }
+
+    /// Returns state being visited.
+    State getCurState() const
+    {
+        if (_accelPlayer)
+            return _accelPlayer->getCurState();
+        if (_shengPlayer)
+            return _shengPlayer->getCurState();
+        if (_stridePlayer)
+            return _stridePlayer->getCurState();
+
+        return _tablePlayer.getCurState();
+    }
+
+    /// Returns index of the state being visited.
+    Index getCurIndex() const
+    {
+        if (_accelPlayer)
+            return _accelPlayer->getCurIndex();
+        if (_shengPlayer)
+            return _shengPlayer->getCurIndex();
+        if (_stridePlayer)
+            return _stridePlayer->getCurIndex();
+
+        return _tablePlayer.getCurIndex();
+    }
+
+    /// Returns current position in the replayed sequence.
+    std::uint64_t getCurPos() const
+    {
+        if (_accelPlayer)
+            return _accelPlayer->getCurPos();
+        if (_shengPlayer)
+            return _shengPlayer->getCurPos();
+        if (_stridePlayer)
+            return _stridePlayer->getCurPos();
+
+        return _tablePlayer.getCurPos();
+    }
+
+    /// Returns the last considered symbol.
+    Alpha getLastSymbol() const
+    {
+        if (_accelPlayer)
+            return _accelPlayer->getLastSymbol();
+        if (_shengPlayer)
+            return _shengPlayer->getLastSymbol();
+        if (_stridePlayer)
+            return _stridePlayer->getLastSymbol();
+
+        return _tablePlayer.getLastSymbol();
+    }
+
+protected:
+    /// Player of the dense table.
+    typedef BasicCompiledDfaPlayer<State, Alpha, NullListener> TablePlayer;
+
+    /// Player of the Sheng automaton.
+    typedef ShengDfaPlayer<State, Alpha> ShengPlayer;
+
+    /// Player of the stride automaton.
+    typedef StrideDfaPlayer<State, Alpha> StridePlayer;
+
+    /// Player of the accelerated automaton.
+    typedef AccelDfaPlayer<State, Alpha> AccelPlayer;
+
+protected:
+    const SpecAutoDfa& _dfa;            ///< Ref to the automaton.
+    TablePlayer _tablePlayer;           ///< Player of the table, if used.
+
+    /// Player of the Sheng automaton, if used.
+    std::unique_ptr<ShengPlayer> _shengPlayer;
+
+    /// Player of the stride automaton, if used.
+    std::unique_ptr<StridePlayer> _stridePlayer;
+
+    /// Player of the accelerated automaton, if used.
+    std::unique_ptr<AccelPlayer> _accelPlayer;
+}; // class AutoDfaPlayer
+
+
+
+#endif // AUTO_DFA_HPP_
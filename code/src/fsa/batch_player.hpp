@@ -0,0 +1,184 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains declarations of the type for parallel batch replays.
+/// \author     DFA library contributors
+/// \version    0.1.0
+/// \date       16.10.2026
+/// \copyright  © DFA library contributors 2026.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef BATCH_PLAYER_HPP_
+#define BATCH_PLAYER_HPP_
+
+
+#include <string_view>
+#include <vector>
+
+#include "parallel_player.hpp"
+#include "shared_dfa.hpp"
+#include "thread_pool.hpp"
+
+
+
+/*! ****************************************************************************
+ *  \brief BatchDfaPlayer replays many independent sequences in a shared
+ *  compiled automaton on the threads of a WorkStealingPool.
+ *
+ *  Sequences are grouped into tasks of about getGrain() symbols each, in
+ *  the order given: short sequences share a task and a long one makes a task
+ *  of its own. Sequences of at least getLongLen() symbols are replayed after
+ *  the others, each split over all the threads by a ParallelDfaPlayer, if
+ *  the automaton is small enough for it. Results are written to an array
+ *  given by the caller; a batch allocates nothing per sequence.
+ *
+ *  A batch player must not be used by several threads at once.
+ *
+ *  \tparam State is a data type for representing states.
+ *  \tparam Alpha represent elements of the alphabet of an automaton.
+ ******************************************************************************/
+template<typename State, typename Alpha>
+class BatchDfaPlayer {
+public:
+    // aliases for State and Alpha
+    typedef State TState;
+    typedef Alpha TAlpha;
+
+    /// Handle of the automaton.
+    typedef SharedDfa<State, Alpha> SpecSharedDfa;
+
+    /// Sequence of a batch.
+    typedef std::basic_string_view<Alpha> Sequence;
+
+    /// Results of replaying (shared with DfaPlayer).
+    typedef PlayResult Result;
+
+    /// Default number of symbols per task.
+    static constexpr size_t DefGrain = 1 << 14;
+
+    /// Cost of a sequence in symbols, besides its length, for grouping.
+    static constexpr size_t SeqCost = 16;
+
+    /// Default length of a sequence to be split over the threads.
+    static constexpr size_t DefLongLen = 1 << 20;
+
+public:
+    // Constructors and all.
+
+    /// Inititalizes a player with a shared automaton, a pool, a number
+    /// of symbols per task and a length of sequences split over the threads.
+    BatchDfaPlayer(const SpecSharedDfa& dfa, WorkStealingPool& pool,
+                   size_t grain = DefGrain, size_t longLen = DefLongLen)
+        : _dfa(dfa)
+        , _pool(pool)
+        , _grain(grain ? grain : 1)
+        , _longLen(longLen)
+        , _longPlayer(dfa, pool)
+    {
+    }
+
+public:
+
+    /// Plays \a n sequences \a seqs and writes the result of the sequence
+    /// `seqs[i]` to `results[i]`, as BasicCompiledDfaPlayer::play() returns.
+    void playBatch(const Sequence* seqs, size_t n, Result* results)
+    {
+        // tasks are the ranges [_bounds[t], _bounds[t + 1]) of sequences
+        _bounds.clear();
+        _bounds.push_back(0);
+        _longs.clear();
+        size_t cost = 0;
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (isLong(seqs[i].size()))
+            {
+                _longs.push_back(i);
+                continue;
+            }
+
+            cost += seqs[i].size() + SeqCost;
+            if (cost >= _grain)
+            {
+                _bounds.push_back(i + 1);
+                cost = 0;
+            }
+        }
+        if (_bounds.back() != n)
+            _bounds.push_back(n);
+
+        const SpecCompiledDfa& dfa = *_dfa;
+        _pool.parallelFor(_bounds.size() - 1, [&](size_t t)
+        {
+            BasicCompiledDfaPlayer<State, Alpha, NullListener> player(dfa);
+            for (size_t i = _bounds[t]; i < _bounds[t + 1]; ++i)
+            {
+                if (!isLong(seqs[i].size()))
+                    results[i] = player.play(seqs[i]);
+            }
+        });
+
+        for (size_t i : _longs)
+            results[i] = _longPlayer.play(seqs[i]);
+    }
+
+    /// Plays the sequences \a seqs.
+    /// \return results of the sequences, in the same order.
+    std::vector<Result> playBatch(const std::vector<Sequence>& seqs)
+    {
+        std::vector<Result> results(seqs.size());
+        playBatch(seqs.data(), seqs.size(), results.data());
+
+        return results;
+    }
+
+    /// \return handle of the automaton.
+    const SpecSharedDfa& getDfa() const { return _dfa; }
+
+    /// \return number of symbols per task.
+    size_t getGrain() const { return _grain; }
+
+    /// \return length of sequences split over the threads.
+    size_t getLongLen() const { return _longLen; }
+
+protected:
+    /// Specified compiled DFA.
+    typedef CompiledDfa<State, Alpha> SpecCompiledDfa;
+
+protected:
+    /// \return true if a sequence of \a len symbols is split over the threads.
+    bool isLong(size_t len) const
+    {
+        return len >= _longLen && _longPlayer.isSplit(len);
+    }
+
+protected:
+    SpecSharedDfa _dfa;                 ///< Handle of the automaton.
+    WorkStealingPool& _pool;            ///< Pool of threads.
+    size_t _grain;                      ///< Number of symbols per task.
+    size_t _longLen;                    ///< Length of sequences to split.
+    std::vector<size_t> _bounds;        ///< Bounds of tasks, reused.
+    std::vector<size_t> _longs;         ///< Sequences to split, reused.
+
+    /// Player of the sequences to split.
+    ParallelDfaPlayer<State, Alpha> _longPlayer;
+}; // class BatchDfaPlayer
+
+
+template<typename State, typename Alpha>
+constexpr size_t BatchDfaPlayer<State, Alpha>::DefGrain;
+
+template<typename State, typename Alpha>
+constexpr size_t BatchDfaPlayer<State, Alpha>::SeqCost;
+
+template<typename State, typename Alpha>
+constexpr size_t BatchDfaPlayer<State, Alpha>::DefLongLen;
+
+
+
+#endif // BATCH_PLAYER_HPP_
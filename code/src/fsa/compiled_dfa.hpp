@@ -0,0 +1,657 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains declarations of the types for compiled (frozen) DFAs.
+/// \author     DFA library contributors
+/// \version    0.1.0
+/// \date       16.10.2026
+/// \copyright  © DFA library contributors 2026.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef COMPILED_DFA_HPP_
+#define COMPILED_DFA_HPP_
+
+
+#include <vector>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+
+#include "dfa.hpp"
+#include "flat_array.hpp"
+#include "interner.hpp"
+
+
+template<typename State, typename Alpha>
+class DfaImage;
+
+
+/*! ****************************************************************************
+ *  \brief CompiledDfa is a frozen, read-only form of a Dfa.
+ *
+ *  States and symbols are interned into dense indices once, at construction
+ *  time, and all the tables work on the indices; user values are restored
+ *  only when reported back to a caller.
+ *
+ *  Symbols that lead from every state to the same state are merged into
+ *  a single equivalence class, and the transition function is stored as
+ *  a contiguous `states x classes` array of state indices. A missing
+ *  transition is denoted by the sentinel value NoTrans.
+ *
+ *  The tables either are owned by the automaton or refer to an image mapped
+ *  into memory (see DfaImage); copies of the latter share the image.
+ *
+ *  A constructed automaton is never modified: all its methods are const and
+ *  only read the tables, so any number of threads may use the same object
+ *  concurrently (see SharedDfa), each with a player of its own.
+ *
+ *  \tparam State is a data type for representing states.
+ *  \tparam Alpha represent elements of the alphabet of an automaton.
+ ******************************************************************************/
+template<typename State, typename Alpha>
+class CompiledDfa {
+public:
+    // aliases for State and Alpha
+    typedef State TState;
+    typedef Alpha TAlpha;
+
+    /// Specified DFA (with set state and symbol types).
+    typedef Dfa<State, Alpha> SpecDfa;
+
+    /// Dense index of a state or a symbol.
+    typedef InternId Index;
+
+    /// Sentinel denoting the absence of a transition.
+    static constexpr Index NoTrans = ~Index(0);
+
+    /// Fates of states indexed by their indices.
+    typedef std::vector<StateFate> Fates;
+
+    /// Symbols are mapped to classes by a direct table.
+    static constexpr bool HasClassTable = std::is_integral<Alpha>::value
+                                          && !std::is_same<Alpha, bool>::value
+                                          && sizeof(Alpha) <= 2;
+
+public:
+    // Constructors and all.
+
+    /// Freezes the automaton \a dfa.
+    explicit CompiledDfa(const SpecDfa& dfa)
+        : _states(dfa.getStates().begin(), dfa.getStates().end())
+        , _symbolsNum(dfa.getSymbolsNum())
+    {
+        // an empty automaton is represented by a single dead state
+        if (_states.size() == 0)
+        {
+            State dead[] = { State() };
+            _states = StateInterner(dead, dead + 1);
+        }
+
+        Interner<Alpha> symbols(dfa.getAlphabet().begin(),
+                                dfa.getAlphabet().end());
+
+        // a column of a symbol is a list of (source, destination) pairs of
+        // its transitions; the table is ordered by states, so are the columns
+        typedef std::vector<std::pair<Index, Index>> Column;
+        std::vector<Column> cols(symbols.size());
+        for (const auto& t : dfa.getTransTable())
+        {
+            cols[symbols.find(t.first.second)].push_back(
+                        {_states.find(t.first.first), _states.find(t.second)});
+        }
+
+        // symbols with equal columns are equivalent in every state
+        std::vector<Index> order(symbols.size());
+        for (Index i = 0; i < order.size(); ++i)
+            order[i] = i;
+        std::stable_sort(order.begin(), order.end(), [&cols](Index a, Index b)
+                         { return cols[a] < cols[b]; });
+
+        std::vector<Index> classOf(symbols.size());
+        std::vector<Index> reps;            // representatives of classes
+        for (size_t i = 0; i < order.size(); ++i)
+        {
+            if (i == 0 || cols[order[i]] != cols[order[i - 1]])
+                reps.push_back(order[i]);
+            classOf[order[i]] = Index(reps.size() - 1);
+        }
+
+        // number classes by their least symbols
+        std::vector<Index> renum(reps.size());
+        std::vector<Index> byRep(reps.size());
+        for (Index i = 0; i < byRep.size(); ++i)
+            byRep[i] = i;
+        std::sort(byRep.begin(), byRep.end(), [&reps](Index a, Index b)
+                  { return reps[a] < reps[b]; });
+        for (Index i = 0; i < byRep.size(); ++i)
+            renum[byRep[i]] = i;
+        for (Index& c : classOf)
+            c = renum[c];
+
+        _classes = SymbolClassMap(symbols, classOf);
+        _classesNum = reps.size();
+
+        std::vector<Index> table(_states.size() * _classesNum, NoTrans);
+        for (Index a = 0; a < cols.size(); ++a)
+        {
+            for (const auto& sd : cols[a])
+                table[sd.first * _classesNum + classOf[a]] = sd.second;
+        }
+        _table = FlatArray<Index>(std::move(table));
+
+        std::vector<std::uint64_t> fin(getFinWordsNum(_states.size()), 0);
+        for (State s : dfa.getFinStates())
+        {
+            Index i = _states.find(s);
+            fin[i / 64] |= std::uint64_t(1) << (i % 64);
+        }
+        _fin = FlatArray<std::uint64_t>(std::move(fin));
+
+        _init = (dfa.getStatesNum() != 0) ? _states.find(dfa.getInitState())
+                                          : 0;
+    }
+
+public:
+    // Setters/getters
+
+    /// \return number of states in an automaton.
+    size_t getStatesNum() const { return _states.size(); }
+
+    /// \return number of symbols in an automaton.
+    size_t getSymbolsNum() const { return _symbolsNum; }
+
+    /// \return number of symbol equivalence classes, i.e. the width of
+    /// a row of the transition table.
+    size_t getClassesNum() const { return _classesNum; }
+
+    /// \return index of the init state.
+    Index getInitIndex() const { return _init; }
+
+    /// \return state with the index \a i.
+    State getState(Index i) const { return _states.value(i); }
+
+    /// Looks up the index of the state \a s.
+    /// \return true if \a s is a state of the DFA, false otherwise.
+    bool getStateIndex(State s, Index& i) const
+    {
+        i = _states.find(s);
+        return i != NoInternId;
+    }
+
+    /// Looks up the equivalence class of the symbol \a a.
+    /// \return true if \a a belongs to the alphabet, false otherwise.
+    bool getSymbolClass(Alpha a, Index& c) const
+    {
+        c = _classes.find(a);
+        return c != NoInternId;
+    }
+
+    /// \return index of the state reached from the state \a s by a symbol
+    /// of the class \a c, or NoTrans if there is no such transition.
+    Index getTransIndex(Index s, Index c) const
+    {
+        return _table[s * _classesNum + c];
+    }
+
+    /// \return the flat `states x classes` transition table.
+    const Index* getTransTable() const { return _table.data(); }
+
+    /// \return the direct table of classes indexed by unsigned values of
+    /// symbols, or null if symbols are not small integers.
+    const Index* getClassTable() const
+    {
+        if constexpr (HasClassTable)
+            return _classes.table();
+        else
+            return nullptr;
+    }
+
+    /// \return true if the state with the index \a s is accepting.
+    bool isFinIndex(Index s) const
+    {
+        return ((_fin[s / 64] >> (s % 64)) & 1) != 0;
+    }
+
+    /// Finds the states a replay is certain to be accepted or rejected in
+    /// whatever follows, as Dfa::getFates() does.
+    /// \return the fates of all the states by their indices.
+    Fates getFates(bool closedAlphabet = false) const
+    {
+        const size_t n = getStatesNum();
+        const bool total = closedAlphabet
+                || _symbolsNum == getAlphaValuesNum<Alpha>();
+
+        std::vector<std::pair<Index, Index>> trans;
+        std::vector<char> fin(n), complete(n);
+        for (Index s = 0; s < n; ++s)
+        {
+            size_t outNum = 0;
+            for (Index c = 0; c < _classesNum; ++c)
+            {
+                Index d = getTransIndex(s, c);
+                if (d == NoTrans)
+                    continue;
+                trans.push_back({s, d});
+                ++outNum;
+            }
+            fin[s] = isFinIndex(s);
+            complete[s] = total && outNum == _classesNum;
+        }
+
+        return findStateFates(n, trans, fin, complete);
+    }
+
+    /// \return number of 64-bit words in the accept bitset of \a statesNum
+    /// states.
+    static size_t getFinWordsNum(size_t statesNum)
+    {
+        return (statesNum + 63) / 64;
+    }
+
+protected:
+    template<typename S, typename A>
+    friend class DfaImage;
+
+    /// Makes an empty automaton to be filled in by a loader.
+    CompiledDfa() = default;
+
+protected:
+    /// Interner of states.
+    typedef Interner<State> StateInterner;
+
+    /// Map of symbols to their classes.
+    typedef ClassMap<Alpha> SymbolClassMap;
+
+protected:
+    StateInterner _states;              ///< Interned states.
+    SymbolClassMap _classes;            ///< Classes of symbols.
+    size_t _symbolsNum;                 ///< Number of symbols.
+    size_t _classesNum;                 ///< Number of classes of symbols.
+    FlatArray<Index> _table;            ///< Flat transition table.
+    FlatArray<std::uint64_t> _fin;      ///< Bitset of accepting states.
+    Index _init;                        ///< Index of the init state.
+
+    /// Keeps alive the memory the arrays refer to, if they do not own it.
+    std::shared_ptr<const void> _storage;
+}; // class CompiledDfa
+
+
+template<typename State, typename Alpha>
+constexpr typename CompiledDfa<State, Alpha>::Index
+    CompiledDfa<State, Alpha>::NoTrans;
+
+template<typename State, typename Alpha>
+constexpr bool CompiledDfa<State, Alpha>::HasClassTable;
+
+
+/*! ****************************************************************************
+ *  \brief Listener policy that forwards the events of BasicCompiledDfaPlayer
+ *  to a DfaEventListener, if any is set, translating indices back to states.
+ ******************************************************************************/
+template<typename State, typename Alpha>
+class CompiledEventAdapter {
+public:
+    /// Specified compiled DFA.
+    typedef CompiledDfa<State, Alpha> SpecCompiledDfa;
+
+    /// Index type of the compiled DFA.
+    typedef typename SpecCompiledDfa::Index Index;
+
+    /// Interface the events are forwarded to.
+    typedef DfaEventListener<State, Alpha> IEventListener;
+
+public:
+    CompiledEventAdapter(const SpecCompiledDfa& dfa, IEventListener* cb)
+        : _dfa(&dfa)
+        , _cb(cb)
+    {
+    }
+
+    void onStateChanging(Index preS, Index newS)
+    {
+        if (_cb)
+            _cb->onStateChanging(_dfa->getState(preS), _dfa->getState(newS));
+    }
+
+    void onTransFired(std::uint64_t /*pos*/, Index s, Alpha a, Index /*c*/,
+                      Index d)
+    {
+        if (_cb)
+            _cb->onTransFired(_dfa->getState(s), a, _dfa->getState(d));
+    }
+
+    void onNoTrans(std::uint64_t /*pos*/, Index /*s*/, Alpha /*a*/) {}
+
+    /// Returns the listener the events are forwarded to.
+    IEventListener* get() const { return _cb; }
+
+protected:
+    const SpecCompiledDfa* _dfa;        ///< Automaton of the indices.
+    IEventListener* _cb;                ///< Callback listener.
+}; // class CompiledEventAdapter
+
+
+/*! ****************************************************************************
+ *  \brief Player used to replay a given string in a compiled automaton, which
+ *  reports events to a listener policy by static dispatch.
+ *
+ *  Provides the same semantics as DfaPlayer does. The \a Listener is stored by
+ *  value and works on indices: it is called as
+ *  `onStateChanging(Index preS, Index newS)` when a replay starts and as
+ *  `onTransFired(uint64_t pos, Index s, Alpha a, Index c, Index d)` for every
+ *  fired transition, where \a pos is the position of the symbol \a a of
+ *  the class \a c, so the transition is in the slot `s * classes + c` of
+ *  the table, and as `onNoTrans(uint64_t pos, Index s, Alpha a)` when
+ *  a replay breaks off.
+ *
+ *  Replays stop early in states of certain fates, if set (see setFates()),
+ *  as replays of BasicDfaPlayer do.
+ *
+ *  \tparam State is a data type for representing states.
+ *  \tparam Alpha represent elements of the alphabet of an automaton.
+ *  \tparam Listener is a listener policy type, e.g. NullListener.
+ ******************************************************************************/
+template<typename State, typename Alpha, typename Listener>
+class BasicCompiledDfaPlayer {
+public:
+    // aliases for State and Alpha
+    typedef State TState;
+    typedef Alpha TAlpha;
+
+    /// Specified compiled DFA.
+    typedef CompiledDfa<State, Alpha> SpecCompiledDfa;
+
+    /// Index type of the compiled DFA.
+    typedef typename SpecCompiledDfa::Index Index;
+
+    /// Results of replaying (shared with DfaPlayer).
+    typedef PlayResult Result;
+
+    /// Interface for callbacks with runtime polymorphism.
+    typedef DfaEventListener<State, Alpha> IEventListener;
+
+    /// Fates of states.
+    typedef typename SpecCompiledDfa::Fates Fates;
+
+public:
+    // Constructors and all.
+
+    /// Inititalizes a player with a compiled automaton and a listener.
+    explicit BasicCompiledDfaPlayer(const SpecCompiledDfa& dfa,
+                                    Listener listener = Listener())
+        : _dfa(dfa)
+        , _listener(listener)
+        , _fates(nullptr)
+    {
+        _curPos = 0;            // nothing to replay
+        _noTrans = false;
+        _decided = false;
+        _lastSymb = Alpha();
+    }
+
+public:
+
+    /// Plays a sequence given by the range [\a first, \a last) of input
+    /// iterators without copying it.
+    /// \return Result::ok if the sequence was replayed successfully (accepted),
+    /// otherwise it is declined. See DfaPlayer::play() for details.
+    template<typename InputIt>
+    Result play(InputIt first, InputIt last)
+    {
+        begin();
+        feed(first, last);
+
+        return finish();
+    }
+
+    /// Plays a sequence provided as a vector.
+    /// \return Result::ok if the \a seq was replayed successfully (accepted),
+    /// otherwise \a seq is declined. See DfaPlayer::play() for details.
+    Result play(const std::vector<Alpha>& seq)
+    {
+        return play(seq.begin(), seq.end());
+    }
+
+    /// Plays a sequence of \a len symbols stored at \a seq.
+    Result play(const Alpha* seq, size_t len)
+    {
+        return play(seq, seq + len);
+    }
+
+    /// Plays a sequence provided as a string view.
+    template<typename Traits>
+    Result play(std::basic_string_view<Alpha, Traits> seq)
+    {
+        return play(seq.begin(), seq.end());
+    }
+
+    // Streaming replay: begin(), feed() any number of chunks, finish().
+
+    /// Starts replaying a sequence that is fed by chunks.
+    void begin()
+    {
+        init();
+        _noTrans = false;
+    }
+
+    /// Replays the next chunk [\a first, \a last) of the sequence.
+    /// \return false if the replay has already broken off on a missing
+    /// transition, so the rest of the sequence can be dropped.
+    template<typename InputIt>
+    bool feed(InputIt first, InputIt last)
+    {
+        if (_noTrans)
+            return false;
+        if (_decided)
+        {
+            skip(first, last);
+            return true;
+        }
+
+        // the loop keeps its state in locals and stores nothing, so that
+        // the table addresses stay in registers
+        Index s = _curState;
+        std::uint64_t pos = _curPos;
+        Alpha lastSymb = _lastSymb;
+        bool ok = true;
+        const StateFate* fates = _fates ? _fates->data() : nullptr;
+        for ( ; first != last; ++first)
+        {
+            Alpha a = *first;
+            lastSymb = a;
+
+            Index c;
+            Index d = SpecCompiledDfa::NoTrans;
+            if (_dfa.getSymbolClass(a, c))
+                d = _dfa.getTransIndex(s, c);
+            if (d == SpecCompiledDfa::NoTrans)
+            {
+                _listener.onNoTrans(pos, s, a);
+                ok = false;
+                break;
+            }
+
+            _listener.onTransFired(pos, s, a, c, d);
+            s = d;
+            ++pos;
+            if (fates && fates[d] != StateFate::Open)
+            {
+                _decided = true;
+                ++first;
+                break;
+            }
+        }
+        _curState = s;
+        _curPos = pos;
+        _lastSymb = lastSymb;
+        _noTrans = !ok;
+        if (_decided)
+            skip(first, last);
+
+        return ok;
+    }
+
+    /// Replays the next chunk of \a len symbols stored at \a chunk.
+    bool feed(const Alpha* chunk, size_t len)
+    {
+        return feed(chunk, chunk + len);
+    }
+
+    /// Replays the next chunk provided as a string view.
+    template<typename Traits>
+    bool feed(std::basic_string_view<Alpha, Traits> chunk)
+    {
+        return feed(chunk.begin(), chunk.end());
+    }
+
+    /// Replays the next chunk provided as a vector.
+    bool feed(const std::vector<Alpha>& chunk)
+    {
+        return feed(chunk.begin(), chunk.end());
+    }
+
+    /// Finishes replaying the fed sequence.
+    /// \return the result as play() would return for the whole sequence.
+    Result finish() const
+    {
+        if (_noTrans)
+            return Result::NoTrans;
+
+        // check for the accepting state
+        if (!_dfa.isFinIndex(_curState))
+            return Result::NonFinState;
+
+        return Result::Ok;
+    }
+
+    /// Sets the fates of states of the automaton, e.g. obtained by
+    /// CompiledDfa::getFates(), to stop replays early, or null not to stop.
+    /// The fates are referred to, not copied.
+    void setFates(const Fates* fates) { _fates = fates; }
+
+    /// Returns the set fates of states, or null.
+    const Fates* getFates() const { return _fates; }
+
+    /// Returns true if the replay has reached a state with a certain fate,
+    /// so the rest of the sequence can change only the position.
+    bool isDecided() const { return _decided; }
+
+    /// Returns state being visited.
+    State getCurState() const { return _dfa.getState(_curState); }
+
+    /// Returns index of the state being visited.
+    Index getCurIndex() const { return _curState; }
+
+    /// Returns current position in the replayed sequence.
+    std::uint64_t getCurPos() const { return _curPos; }
+
+    /// Returns the last considered symbol.
+    Alpha getLastSymbol() const { return _lastSymb; }
+
+    /// Returns the listener.
+    Listener& getListener() { return _listener; }
+    const Listener& getListener() const { return _listener; }
+
+protected:
+
+    /// Initializes the player before the replay.
+    void init()
+    {
+        _curState = _dfa.getInitIndex();
+        _curPos = 0;
+        _lastSymb = Alpha();
+
+        _listener.onStateChanging(_curState, _curState);
+        _decided = _fates && (*_fates)[_curState] != StateFate::Open;
+    }
+
+    /// Counts the symbols of [\a first, \a last) as replayed without
+    /// replaying them.
+    template<typename InputIt>
+    void skip(InputIt first, InputIt last)
+    {
+        typedef typename std::iterator_traits<InputIt>::iterator_category Cat;
+        if constexpr (std::is_base_of<std::random_access_iterator_tag,
+                                      Cat>::value)
+        {
+            if (first == last)
+                return;
+            _curPos += std::uint64_t(last - first);
+            _lastSymb = *(last - 1);
+        }
+        else
+        {
+            for ( ; first != last; ++first)
+            {
+                _lastSymb = *first;
+                ++_curPos;
+            }
+        }
+    }
+
+protected:
+    const SpecCompiledDfa& _dfa;        ///< Ref to the automaton.
+    Index _curState;                    ///< Index of the current state.
+    std::uint64_t _curPos;              ///< Currently replayed symbol.
+    bool _noTrans;                      ///< Replay has broken off.
+    bool _decided;                      ///< Replay has reached a fate.
+    Alpha _lastSymb;                    ///< Stores last replayed symbol.
+
+    Listener _listener;                 ///< Listener policy.
+    const Fates* _fates;                ///< Fates of states, if set.
+}; // class BasicCompiledDfaPlayer
+
+
+/*! ****************************************************************************
+ *  \brief Player used to replay a given string in a compiled automaton.
+ *
+ *  Provides the same semantics as DfaPlayer does, including an IEventListener
+ *  set at runtime.
+ *
+ *  \tparam State is a data type for representing states.
+ *  \tparam Alpha represent elements of the alphabet of an automaton.
+ ******************************************************************************/
+template<typename State, typename Alpha>
+class CompiledDfaPlayer
+        : public BasicCompiledDfaPlayer<State, Alpha,
+                                        CompiledEventAdapter<State, Alpha>> {
+public:
+    /// Base player.
+    typedef BasicCompiledDfaPlayer<State, Alpha,
+                                   CompiledEventAdapter<State, Alpha>> Base;
+
+    typedef typename Base::SpecCompiledDfa SpecCompiledDfa;
+    typedef typename Base::IEventListener IEventListener;
+
+public:
+    // Constructors and all.
+
+    /// Inititalizes a player with a compiled automaton.
+    CompiledDfaPlayer(const SpecCompiledDfa& dfa, IEventListener* cb = nullptr)
+        : Base(dfa, CompiledEventAdapter<State, Alpha>(dfa, cb))
+    {
+    }
+
+public:
+
+    /// Sets a new event listener.
+    void setEventListener(IEventListener* cb)
+    {
+        this->_listener = CompiledEventAdapter<State, Alpha>(this->_dfa, cb);
+    }
+
+    /// Returns the set event listener.
+    IEventListener* getEventListener() const { return this->_listener.get(); }
+}; // class CompiledDfaPlayer
+
+
+
+#endif // COMPILED_DFA_HPP_
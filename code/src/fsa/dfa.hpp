@@ -21,11 +21,112 @@
 #include <set>
 #include <map>
 #include <vector>
+#include <cstdint>
+#include <string_view>
 #include <tuple>
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+
+#include "interner.hpp"
 ////#include <cstddef> // size_t
 
 
 
+/// Fates of states: whether the result of a replay is already certain once
+/// a state is reached.
+enum class StateFate {
+    Open,               ///< The result depends on the rest of a sequence.
+    Accept,             ///< Every continuation is accepted.
+    Reject,             ///< Every continuation ends in a non-accepting state.
+};
+
+
+/// \return number of all the values of the symbol type Alpha if it is a small
+/// integral type, or 0 if an alphabet cannot be made of all of them.
+template<typename Alpha>
+constexpr size_t getAlphaValuesNum()
+{
+    if constexpr (std::is_same<Alpha, bool>::value)
+        return 2;
+    else if constexpr (std::is_integral<Alpha>::value && sizeof(Alpha) <= 2)
+        return size_t(1) << (sizeof(Alpha) * 8);
+    else
+        return 0;
+}
+
+
+/// Finds the fates of \a n states given by their transitions \a trans of
+/// (source, destination) pairs, flags of accepting states \a fin and flags
+/// \a complete of states having transitions by every symbol that may occur.
+/// A state is Accept if it reaches neither a non-accepting nor an incomplete
+/// state, and Reject if it reaches neither an accepting nor an incomplete
+/// one; a replay cannot break off in either, so its result is final. Both
+/// are found by a single backward search each in O(n + transitions).
+inline std::vector<StateFate> findStateFates(size_t n,
+        const std::vector<std::pair<InternId, InternId>>& trans,
+        const std::vector<char>& fin, const std::vector<char>& complete)
+{
+    typedef InternId Id;
+
+    // incoming transitions
+    std::vector<Id> inStart(n + 1, 0), inSrc(trans.size());
+    for (const auto& t : trans)
+        ++inStart[t.second + 1];
+    for (size_t q = 0; q < n; ++q)
+        inStart[q + 1] += inStart[q];
+    {
+        std::vector<Id> fill(inStart.begin(), inStart.end() - 1);
+        for (const auto& t : trans)
+            inSrc[fill[t.second]++] = t.first;
+    }
+
+    // marks the states reaching an incomplete state or a state whose
+    // acceptance is \a acc
+    auto reaching = [&](bool acc)
+    {
+        std::vector<char> mark(n, 0);
+        std::vector<Id> stack;
+        for (Id q = 0; q < n; ++q)
+        {
+            if (!complete[q] || bool(fin[q]) == acc)
+            {
+                mark[q] = 1;
+                stack.push_back(q);
+            }
+        }
+        while (!stack.empty())
+        {
+            Id q = stack.back();
+            stack.pop_back();
+            for (Id i = inStart[q]; i < inStart[q + 1]; ++i)
+            {
+                if (!mark[inSrc[i]])
+                {
+                    mark[inSrc[i]] = 1;
+                    stack.push_back(inSrc[i]);
+                }
+            }
+        }
+
+        return mark;
+    };
+
+    std::vector<char> mayFail = reaching(false);
+    std::vector<char> mayPass = reaching(true);
+    std::vector<StateFate> fates(n, StateFate::Open);
+    for (Id q = 0; q < n; ++q)
+    {
+        if (!mayFail[q])
+            fates[q] = StateFate::Accept;
+        else if (!mayPass[q])
+            fates[q] = StateFate::Reject;
+    }
+
+    return fates;
+}
+
+
 /*! ****************************************************************************
  *  \brief Dfa represents a parametrized deterministic finit state automata.
  *
@@ -61,6 +162,9 @@ public:
     /// Transition function delta mapping StateAlpha to State.
     typedef std::map<StateAlphaPair, State> TransFunc;
 
+    /// Fates of the states whose fate is not StateFate::Open.
+    typedef std::map<State, StateFate> Fates;
+
 public:
 
     // Constructors and all.
@@ -143,6 +247,8 @@ public:
     {
         addState(init);
         _init = init;
+
+        return init;
     }
 
     // Setters/getters
@@ -162,6 +268,18 @@ public:
     /// \return number of accepting states in an automaton.
     size_t getFinStatesNum() const { return _finStates.size(); }
 
+    /// \return set of states.
+    const States& getStates() const { return _states; }
+
+    /// \return alphabet.
+    const Alphabet& getAlphabet() const { return _alphabet; }
+
+    /// \return transition table.
+    const TransFunc& getTransTable() const { return _transTable; }
+
+    /// \return set of accepting states.
+    const States& getFinStates() const { return _finStates; }
+
 
     /// Tries to get a transition from the state \a s labeled \a a.
     /// \return true is there is a valid transition, so \a d is set to the
@@ -192,6 +310,26 @@ public:
         return (_finStates.find(s) != _finStates.end());
     }
 
+public:
+    // Operations on automata.
+
+    /// Builds a minimal automaton accepting the same language by Hopcroft's
+    /// partition refinement, which runs in O(k n log n) for n states and k
+    /// symbols. Unreachable states and states from which no accepting state
+    /// can be reached are dropped; a class of equivalent states is named after
+    /// its least state. If \a oldToNew is given, it is filled with the mapping
+    /// of every retained state to its class.
+    /// \return the minimal automaton.
+    Dfa minimize(std::map<State, State>* oldToNew = nullptr) const;
+
+    /// Finds the states a replay is certain to be accepted or rejected in
+    /// whatever follows (see findStateFates()). Missing transitions break
+    /// a replay off, so only the states having transitions by all the values
+    /// of Alpha qualify, unless \a closedAlphabet is set: then sequences are
+    /// assumed to be made of the symbols of the alphabet only.
+    /// \return the fates of the states that are not StateFate::Open.
+    Fates getFates(bool closedAlphabet = false) const;
+
 protected:
     States _states;             ///< Set of states (Q).
     State _init;                ///< Initial state (q0).
@@ -201,16 +339,388 @@ protected:
 }; // class Dfa
 
 
+template<typename State, typename Alpha>
+Dfa<State, Alpha> Dfa<State, Alpha>::minimize(
+        std::map<State, State>* oldToNew) const
+{
+    typedef InternId Id;
+
+    Interner<State> states(_states.begin(), _states.end());
+    Interner<Alpha> symbols(_alphabet.begin(), _alphabet.end());
+    const size_t n = states.size();
+
+    // outgoing transitions, the table is already ordered by source states
+    std::vector<Id> outStart(n + 1, 0), outSym, outDst;
+    outSym.reserve(_transTable.size());
+    outDst.reserve(_transTable.size());
+    for (const auto& t : _transTable)
+    {
+        ++outStart[states.find(t.first.first) + 1];
+        outSym.push_back(symbols.find(t.first.second));
+        outDst.push_back(states.find(t.second));
+    }
+    for (size_t q = 0; q < n; ++q)
+        outStart[q + 1] += outStart[q];
+
+    // incoming transitions
+    std::vector<Id> inStart(n + 1, 0), inSym(outSym.size()), inSrc(outSym.size());
+    for (Id d : outDst)
+        ++inStart[d + 1];
+    for (size_t q = 0; q < n; ++q)
+        inStart[q + 1] += inStart[q];
+    {
+        std::vector<Id> fill(inStart.begin(), inStart.end() - 1);
+        for (Id q = 0; q < n; ++q)
+        {
+            for (Id i = outStart[q]; i < outStart[q + 1]; ++i)
+            {
+                Id j = fill[outDst[i]]++;
+                inSym[j] = outSym[i];
+                inSrc[j] = q;
+            }
+        }
+    }
+
+    // retain states that are both reachable and co-reachable
+    std::vector<char> reach(n, 0), coreach(n, 0);
+    std::vector<Id> stack;
+    if (n != 0)
+    {
+        Id init = states.find(_init);
+        reach[init] = 1;
+        stack.push_back(init);
+    }
+    while (!stack.empty())
+    {
+        Id q = stack.back();
+        stack.pop_back();
+        for (Id i = outStart[q]; i < outStart[q + 1]; ++i)
+        {
+            if (!reach[outDst[i]])
+            {
+                reach[outDst[i]] = 1;
+                stack.push_back(outDst[i]);
+            }
+        }
+    }
+    for (State f : _finStates)
+    {
+        Id q = states.find(f);
+        coreach[q] = 1;
+        stack.push_back(q);
+    }
+    while (!stack.empty())
+    {
+        Id q = stack.back();
+        stack.pop_back();
+        for (Id i = inStart[q]; i < inStart[q + 1]; ++i)
+        {
+            if (!coreach[inSrc[i]])
+            {
+                coreach[inSrc[i]] = 1;
+                stack.push_back(inSrc[i]);
+            }
+        }
+    }
+
+    // partition: the members of a block b occupy elems[first[b], end[b]),
+    // marked ones are moved to the front [first[b], mid[b])
+    const Id None = NoInternId;
+    std::vector<Id> elems, loc(n, None), blk(n, None);
+    std::vector<Id> first, mid, end;
+    for (int fin = 1; fin >= 0; --fin)
+    {
+        Id b = Id(first.size());
+        Id from = Id(elems.size());
+        for (Id q = 0; q < n; ++q)
+        {
+            if (reach[q] && coreach[q] && hasFinState(states.value(q)) == bool(fin))
+            {
+                loc[q] = Id(elems.size());
+                blk[q] = b;
+                elems.push_back(q);
+            }
+        }
+        if (elems.size() != from)
+        {
+            first.push_back(from);
+            mid.push_back(from);
+            end.push_back(Id(elems.size()));
+        }
+    }
+
+    // for partial transition functions every initial block is a splitter
+    std::vector<Id> work;
+    for (Id b = 0; b < first.size(); ++b)
+        work.push_back(b);
+
+    std::vector<std::pair<Id, Id>> pre;     // (symbol, source) pairs
+    std::vector<Id> touched;
+    while (!work.empty())
+    {
+        Id b = work.back();
+        work.pop_back();
+
+        pre.clear();
+        for (Id i = first[b]; i < end[b]; ++i)
+        {
+            Id d = elems[i];
+            for (Id j = inStart[d]; j < inStart[d + 1]; ++j)
+            {
+                if (blk[inSrc[j]] != None)
+                    pre.push_back({inSym[j], inSrc[j]});
+            }
+        }
+        std::sort(pre.begin(), pre.end());
+
+        for (size_t i = 0; i < pre.size(); )
+        {
+            // mark the preimage of the splitter under one symbol
+            Id a = pre[i].first;
+            for ( ; i < pre.size() && pre[i].first == a; ++i)
+            {
+                Id q = pre[i].second;
+                Id x = blk[q];
+                if (loc[q] < mid[x])
+                    continue;           // already marked
+
+                if (mid[x] == first[x])
+                    touched.push_back(x);
+                Id p = elems[mid[x]];
+                std::swap(elems[loc[q]], elems[mid[x]]);
+                loc[p] = loc[q];
+                loc[q] = mid[x]++;
+            }
+
+            // split touched blocks, the smaller part becomes a new splitter
+            for (Id x : touched)
+            {
+                if (mid[x] == end[x])
+                {
+                    mid[x] = first[x];
+                    continue;
+                }
+
+                Id y = Id(first.size());
+                if (mid[x] - first[x] <= end[x] - mid[x])
+                {
+                    first.push_back(first[x]);
+                    end.push_back(mid[x]);
+                    first[x] = mid[x];
+                }
+                else
+                {
+                    first.push_back(mid[x]);
+                    end.push_back(end[x]);
+                    end[x] = mid[x];
+                }
+                mid.push_back(first[y]);
+                mid[x] = first[x];
+
+                for (Id k = first[y]; k < end[y]; ++k)
+                    blk[elems[k]] = y;
+                work.push_back(y);
+            }
+            touched.clear();
+        }
+    }
+
+    // name each block after its least state, which comes first in id order
+    std::vector<Id> rep(first.size(), None);
+    for (Id q = 0; q < n; ++q)
+    {
+        if (blk[q] != None && rep[blk[q]] == None)
+            rep[blk[q]] = q;
+    }
+
+    Dfa res;
+    for (Alpha a : _alphabet)
+        res.addSymbol(a);
+    if (n == 0)
+        return res;
+
+    Id init = states.find(_init);
+    if (blk[init] == None)
+    {
+        // the language is empty
+        res.setInitState(_init);
+        if (oldToNew)
+            oldToNew->insert({_init, _init});
+        return res;
+    }
+
+    res.setInitState(states.value(rep[blk[init]]));
+    for (Id b = 0; b < rep.size(); ++b)
+    {
+        Id q = rep[b];
+        State s = states.value(q);
+        res.addState(s);
+        if (hasFinState(s))
+            res.addFinState(s);
+        for (Id i = outStart[q]; i < outStart[q + 1]; ++i)
+        {
+            if (blk[outDst[i]] != None)
+                res.addTrans(s, symbols.value(outSym[i]),
+                             states.value(rep[blk[outDst[i]]]));
+        }
+    }
+
+    if (oldToNew)
+    {
+        for (Id q = 0; q < n; ++q)
+        {
+            if (blk[q] != None)
+                oldToNew->insert({states.value(q), states.value(rep[blk[q]])});
+        }
+    }
+
+    return res;
+}
+
+
+template<typename State, typename Alpha>
+typename Dfa<State, Alpha>::Fates Dfa<State, Alpha>::getFates(
+        bool closedAlphabet) const
+{
+    typedef InternId Id;
+
+    Interner<State> states(_states.begin(), _states.end());
+    const size_t n = states.size();
+    const bool total = closedAlphabet
+            || _alphabet.size() == getAlphaValuesNum<Alpha>();
+
+    std::vector<std::pair<Id, Id>> trans;
+    std::vector<size_t> outNum(n, 0);
+    trans.reserve(_transTable.size());
+    for (const auto& t : _transTable)
+    {
+        Id q = states.find(t.first.first);
+        trans.push_back({q, states.find(t.second)});
+        ++outNum[q];
+    }
+
+    std::vector<char> fin(n), complete(n);
+    for (Id q = 0; q < n; ++q)
+    {
+        fin[q] = hasFinState(states.value(q));
+        complete[q] = total && outNum[q] == _alphabet.size();
+    }
+
+    std::vector<StateFate> fates = findStateFates(n, trans, fin, complete);
+    Fates res;
+    for (Id q = 0; q < n; ++q)
+    {
+        if (fates[q] != StateFate::Open)
+            res.insert({states.value(q), fates[q]});
+    }
+
+    return res;
+}
+
+
+/// Results of replaying shared by all the players.
+enum class PlayResult {
+    Ok,                 ///< Replayed successfully.
+    NoTrans,            ///< Broken, no appropriate transition.
+    NonFinState,        ///< Ended up in a non-accepting state.
+};
+
+
 /*! ****************************************************************************
- *  \brief Player used to replay a given string in a given automaton.
+ *  \brief Interface for callbacks of players with runtime polymorphism.
+ ******************************************************************************/
+template<typename State, typename Alpha>
+class DfaEventListener {
+public:
+    /// Called when the current state is being changed.
+    /// \param preS defines previous state.
+    /// \param newS defines new state.
+    virtual void onStateChanging(State preS, State newS) = 0;
+
+    /// Called when a transition is fired.
+    /// \param s defines current state (source).
+    /// \param a defines a symbol activating the transition.
+    /// \param s defines new state (destination).
+    virtual void onTransFired(State s, Alpha a, State d) = 0;
+protected:
+    ~DfaEventListener() {}
+}; // class DfaEventListener
+
+
+/*! ****************************************************************************
+ *  \brief Listener policy that ignores all the events of any player.
+ *
+ *  All the hooks are empty inline functions, so a player with this policy
+ *  compiles down to a bare transition loop.
+ ******************************************************************************/
+struct NullListener {
+    template<typename... Args>
+    void onStateChanging(Args&&...) {}
+
+    template<typename... Args>
+    void onTransFired(Args&&...) {}
+
+    template<typename... Args>
+    void onNoTrans(Args&&...) {}
+}; // struct NullListener
+
+
+/*! ****************************************************************************
+ *  \brief Listener policy that forwards the events of BasicDfaPlayer to
+ *  a DfaEventListener, if any is set.
+ ******************************************************************************/
+template<typename State, typename Alpha>
+class DfaEventAdapter {
+public:
+    /// Interface the events are forwarded to.
+    typedef DfaEventListener<State, Alpha> IEventListener;
+
+public:
+    DfaEventAdapter(IEventListener* cb = nullptr) : _cb(cb) {}
+
+    void onStateChanging(State preS, State newS)
+    {
+        if (_cb)
+            _cb->onStateChanging(preS, newS);
+    }
+
+    void onTransFired(State s, Alpha a, State d)
+    {
+        if (_cb)
+            _cb->onTransFired(s, a, d);
+    }
+
+    /// Returns the listener the events are forwarded to.
+    IEventListener* get() const { return _cb; }
+
+protected:
+    IEventListener* _cb;                ///< Callback listener.
+}; // class DfaEventAdapter
+
+
+/*! ****************************************************************************
+ *  \brief Player used to replay a given string in a given automaton, which
+ *  reports events to a listener policy by static dispatch.
+ *
+ *  The \a Listener is stored by value and is called as
+ *  `onStateChanging(State preS, State newS)` when a replay starts and as
+ *  `onTransFired(State s, Alpha a, State d)` for every fired transition.
+ *
+ *  If the fates of states are set (see setFates()), a replay stops as soon as
+ *  it reaches a state whose fate is not StateFate::Open: the rest of
+ *  a sequence is only counted, so the result, the position and the last
+ *  symbol are the same as without fates, and no more events are reported.
+ *  The current state stays the one reached; in a minimal automaton it is
+ *  the only state of its fate, so it is the same as well.
  *
  *  \tparam State is a data type for representing states. Must be compact enough
  *  to maintain multiple copy-by-value operations.
  *  \tparam Alpha represent elements of the alphabet of an automaton. Must be
  *  compact enough to maintain multiple copy-by-value operations.
+ *  \tparam Listener is a listener policy type, e.g. NullListener.
  ******************************************************************************/
-template<typename State, typename Alpha>
-class DfaPlayer {
+template<typename State, typename Alpha, typename Listener>
+class BasicDfaPlayer {
 public:
     // aliases for State and Alpha
     typedef State TState;
@@ -220,84 +730,169 @@ public:
     typedef Dfa<State, Alpha> SpecDfa;
 
     /// Results of replaying.
-    enum class Result {
-        Ok,                 ///< Replayed successfully.
-        NoTrans,            ///< Broken, no appropriate transition.
-        NonFinState,        ///< Ended up in a non-accepting state.
-    };
-
-    /// Interface for callbacks.
-    class IEventListener {
-    public:
-        /// Called when the current state is being changed.
-        /// \param preS defines previous state.
-        /// \param newS defines new state.
-        virtual void onStateChanging(State preS, State newS) = 0;
-
-        /// Called when a transition is fired.
-        /// \param s defines current state (source).
-        /// \param a defines a symbol activating the transition.
-        /// \param s defines new state (destination).
-        virtual void onTransFired(State s, Alpha a, State d) = 0;
-    protected:
-        ~IEventListener() {}
-    };
+    typedef PlayResult Result;
 
+    /// Interface for callbacks with runtime polymorphism.
+    typedef DfaEventListener<State, Alpha> IEventListener;
 
+    /// Fates of states.
+    typedef typename SpecDfa::Fates Fates;
 
 public:
     // Constructors and all.
 
-    /// Inititalizes a player with an automaton.
-    DfaPlayer(const SpecDfa& dfa, IEventListener* cb = nullptr)
+    /// Inititalizes a player with an automaton and a listener.
+    explicit BasicDfaPlayer(const SpecDfa& dfa, Listener listener = Listener())
         : _dfa(dfa)
-        , _cb(cb)
+        , _listener(listener)
+        , _fates(nullptr)
     {
-        _curPos = -1;           // nothing to replay
+        _curPos = 0;            // nothing to replay
+        _noTrans = false;
+        _decided = false;
+        _lastSymb = Alpha();
     }
 
 public:
 
+    /// Plays a sequence given by the range [\a first, \a last) of input
+    /// iterators without copying it.
+    /// \return Result::ok if the sequence was replayed successfully (accepted),
+    /// otherwise it is declined. In the latter case see methods getCurState(),
+    /// getCurPos() and getLastSymbol() to obain info about last replayed symbol
+    /// and corresponding state.
+    template<typename InputIt>
+    Result play(InputIt first, InputIt last)
+    {
+        begin();
+        feed(first, last);
+
+        return finish();
+    }
+
     /// Plays a sequence provided as a vector.
     /// \return Result::ok if the \a seq was replayed successfully (accepted),
     /// otherwise \a seq is declined. In the latter case see methods getCurState(),
     /// getCurPos() and getLastSymbol() to obain info about last replayed symbol
     /// and corresponding state.
     Result play(const std::vector<Alpha>& seq)
+    {
+        return play(seq.begin(), seq.end());
+    }
+
+    /// Plays a sequence of \a len symbols stored at \a seq.
+    Result play(const Alpha* seq, size_t len)
+    {
+        return play(seq, seq + len);
+    }
+
+    /// Plays a sequence provided as a string view.
+    template<typename Traits>
+    Result play(std::basic_string_view<Alpha, Traits> seq)
+    {
+        return play(seq.begin(), seq.end());
+    }
+
+    // Streaming replay: begin(), feed() any number of chunks, finish().
+
+    /// Starts replaying a sequence that is fed by chunks.
+    void begin()
     {
         init();
-        for (Alpha a : seq)
+        _noTrans = false;
+    }
+
+    /// Replays the next chunk [\a first, \a last) of the sequence.
+    /// \return false if the replay has already broken off on a missing
+    /// transition, so the rest of the sequence can be dropped.
+    template<typename InputIt>
+    bool feed(InputIt first, InputIt last)
+    {
+        if (_noTrans)
+            return false;
+        if (_decided)
         {
-            if (!replaySymb(a))
-                return Result::NoTrans;
+            skip(first, last);
+            return true;
         }
 
+        for ( ; first != last; ++first)
+        {
+            State s = _curState;
+            if (!replaySymb(*first))
+            {
+                _noTrans = true;
+                return false;
+            }
+
+            // a fate can only change with the state
+            if (_fates && !(_curState == s) && decide())
+            {
+                skip(++first, last);
+                break;
+            }
+        }
+
+        return true;
+    }
+
+    /// Replays the next chunk of \a len symbols stored at \a chunk.
+    bool feed(const Alpha* chunk, size_t len)
+    {
+        return feed(chunk, chunk + len);
+    }
+
+    /// Replays the next chunk provided as a string view.
+    template<typename Traits>
+    bool feed(std::basic_string_view<Alpha, Traits> chunk)
+    {
+        return feed(chunk.begin(), chunk.end());
+    }
+
+    /// Replays the next chunk provided as a vector.
+    bool feed(const std::vector<Alpha>& chunk)
+    {
+        return feed(chunk.begin(), chunk.end());
+    }
+
+    /// Finishes replaying the fed sequence.
+    /// \return the result as play() would return for the whole sequence.
+    Result finish() const
+    {
+        if (_noTrans)
+            return Result::NoTrans;
+
         // check for the accepting state
         if (!_dfa.hasFinState(_curState))
             return Result::NonFinState;
 
         return Result::Ok;
-        //return true;
     }
 
+    /// Sets the fates of states of the automaton, e.g. obtained by
+    /// Dfa::getFates(), to stop replays early, or null not to stop. The fates
+    /// are referred to, not copied.
+    void setFates(const Fates* fates) { _fates = fates; }
+
+    /// Returns the set fates of states, or null.
+    const Fates* getFates() const { return _fates; }
+
+    /// Returns true if the replay has reached a state with a certain fate,
+    /// so the rest of the sequence can change only the position.
+    bool isDecided() const { return _decided; }
+
     /// Returns state being visited.
     State getCurState() const { return _curState; }
 
     /// Returns current position in the replayed sequence.
-    State getCurPos() const { return _curPos; }
+    std::uint64_t getCurPos() const { return _curPos; }
 
     /// Returns the last considered symbol.
     Alpha getLastSymbol() const { return _lastSymb; }
 
-    /// Sets a new event listener.
-    void setEventListener(IEventListener* cb)
-    {
-        _cb = cb;
-    }
-
-    /// Returns the set event listener.
-    IEventListener* getEventListener() const { return _cb; }
-
+    /// Returns the listener.
+    Listener& getListener() { return _listener; }
+    const Listener& getListener() const { return _listener; }
 
 protected:
 
@@ -306,9 +901,45 @@ protected:
     {
         _curState = _dfa.getInitState();
         _curPos = 0;
+        _lastSymb = Alpha();
+        _decided = false;
 
-        if (_cb)
-            _cb->onStateChanging(_curState, _curState);
+        _listener.onStateChanging(_curState, _curState);
+        if (_fates)
+            decide();
+    }
+
+    /// Checks whether the fate of the current state is certain.
+    /// \return true if it is, so the replay is decided.
+    bool decide()
+    {
+        _decided = _fates->find(_curState) != _fates->end();
+
+        return _decided;
+    }
+
+    /// Counts the symbols of [\a first, \a last) as replayed without
+    /// replaying them.
+    template<typename InputIt>
+    void skip(InputIt first, InputIt last)
+    {
+        typedef typename std::iterator_traits<InputIt>::iterator_category Cat;
+        if constexpr (std::is_base_of<std::random_access_iterator_tag,
+                                      Cat>::value)
+        {
+            if (first == last)
+                return;
+            _curPos += std::uint64_t(last - first);
+            _lastSymb = *(last - 1);
+        }
+        else
+        {
+            for ( ; first != last; ++first)
+            {
+                _lastSymb = *first;
+                ++_curPos;
+            }
+        }
     }
 
     /// Tries to replay another given symbol being in the current state.
@@ -321,9 +952,7 @@ protected:
         if(!_dfa.getTrans(_curState, a, nextSt))
             return false;
 
-        // call back if assigned
-        if (_cb)
-            _cb->onTransFired(_curState, a, nextSt);
+        _listener.onTransFired(_curState, a, nextSt);
 
         _curState = nextSt;
         ++_curPos;
@@ -331,16 +960,59 @@ protected:
         return true;
     }
 
-
-
 protected:
     const SpecDfa& _dfa;                ///< Ref to the automaton.
     State _curState;                    ///< Current state.
-    int _curPos;                        ///< Currently replayed symbol.
+    std::uint64_t _curPos;              ///< Currently replayed symbol.
+    bool _noTrans;                      ///< Replay has broken off.
+    bool _decided;                      ///< Replay has reached a fate.
     Alpha _lastSymb;                    ///< Stores last replayed symbol.
 
-    IEventListener* _cb;                ///< Callback listener.
-}; //
+    Listener _listener;                 ///< Listener policy.
+    const Fates* _fates;                ///< Fates of states, if set.
+}; // class BasicDfaPlayer
+
+
+/*! ****************************************************************************
+ *  \brief Player used to replay a given string in a given automaton.
+ *
+ *  Reports events to an IEventListener set at runtime, if any.
+ *
+ *  \tparam State is a data type for representing states. Must be compact enough
+ *  to maintain multiple copy-by-value operations.
+ *  \tparam Alpha represent elements of the alphabet of an automaton. Must be
+ *  compact enough to maintain multiple copy-by-value operations.
+ ******************************************************************************/
+template<typename State, typename Alpha>
+class DfaPlayer
+        : public BasicDfaPlayer<State, Alpha, DfaEventAdapter<State, Alpha>> {
+public:
+    /// Base player.
+    typedef BasicDfaPlayer<State, Alpha, DfaEventAdapter<State, Alpha>> Base;
+
+    typedef typename Base::SpecDfa SpecDfa;
+    typedef typename Base::IEventListener IEventListener;
+
+public:
+    // Constructors and all.
+
+    /// Inititalizes a player with an automaton.
+    DfaPlayer(const SpecDfa& dfa, IEventListener* cb = nullptr)
+        : Base(dfa, DfaEventAdapter<State, Alpha>(cb))
+    {
+    }
+
+public:
+
+    /// Sets a new event listener.
+    void setEventListener(IEventListener* cb)
+    {
+        this->_listener = DfaEventAdapter<State, Alpha>(cb);
+    }
+
+    /// Returns the set event listener.
+    IEventListener* getEventListener() const { return this->_listener.get(); }
+}; // class DfaPlayer
 
 
 
@@ -0,0 +1,316 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains declarations of the types for binary images of DFAs.
+/// \author     DFA library contributors
+/// \version    0.1.0
+/// \date       16.10.2026
+/// \copyright  © DFA library contributors 2026.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef DFA_IMAGE_HPP_
+#define DFA_IMAGE_HPP_
+
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "compiled_dfa.hpp"
+#include "mapped_file.hpp"
+
+
+
+/// Error in a binary image of a DFA.
+class DfaImageError : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+}; // class DfaImageError
+
+
+/*! ****************************************************************************
+ *  \brief DfaImage saves a compiled DFA to a binary file and loads it back
+ *  by mapping the file into memory.
+ *
+ *  An image consists of the Header followed by four sections, each starting
+ *  at a multiple of Align bytes:
+ *   - states: sorted values of states, their positions are the indices;
+ *   - classes: the direct table of symbol classes, ClassMap::Range entries;
+ *   - table: the `states x classes` transition table of state indices;
+ *   - fin: the bitset of accepting states made of 64-bit words.
+ *
+ *  Numbers are stored in the byte order of the writer, which is checked on
+ *  loading. The checksum is FNV-1a over the header (except the checksum
+ *  itself) and all the sections.
+ *
+ *  Loading checks the sizes in the header against overflows and the image
+ *  bounds, and checks every entry of the classes and the table sections to
+ *  be in range, so even a crafted image cannot make a replay read out of
+ *  bounds; the checksum only guards against accidental damage.
+ *
+ *  A loaded automaton uses all the sections in place, without parsing, and
+ *  keeps the mapping alive. The mapping is shared, so processes that load
+ *  the same image share its physical pages.
+ *
+ *  \tparam State is a data type for representing states, trivially copyable.
+ *  \tparam Alpha represent elements of the alphabet, an integral type of at
+ *  most two bytes.
+ ******************************************************************************/
+template<typename State, typename Alpha>
+class DfaImage {
+public:
+    static_assert(std::is_trivially_copyable<State>::value,
+                  "states of a DFA image must be trivially copyable");
+    static_assert(std::is_integral<Alpha>::value
+                  && !std::is_same<Alpha, bool>::value && sizeof(Alpha) <= 2,
+                  "symbols of a DFA image must be small integers");
+
+    /// Specified compiled DFA.
+    typedef CompiledDfa<State, Alpha> SpecCompiledDfa;
+
+    /// Index type of the compiled DFA.
+    typedef typename SpecCompiledDfa::Index Index;
+
+    /// Version of the format written.
+    static constexpr std::uint32_t Version = 1;
+
+    /// Alignment of sections in bytes.
+    static constexpr size_t Align = 64;
+
+    static_assert(alignof(State) <= Align, "states are overaligned");
+
+    /// Leading part of an image.
+    struct Header {
+        char magic[8];                  ///< Magic, "FSADFA" and two zeros.
+        std::uint32_t version;          ///< Version of the format.
+        std::uint32_t byteOrder;        ///< ByteOrderMark as written.
+        std::uint32_t stateSize;        ///< Size of a state in bytes.
+        std::uint32_t alphaSize;        ///< Size of a symbol in bytes.
+        std::uint32_t indexSize;        ///< Size of an index in bytes.
+        std::uint32_t init;             ///< Index of the init state.
+        std::uint64_t statesNum;        ///< Number of states.
+        std::uint64_t symbolsNum;       ///< Number of symbols.
+        std::uint64_t classesNum;       ///< Number of symbol classes.
+        std::uint64_t statesOff;        ///< Offset of the states section.
+        std::uint64_t classesOff;       ///< Offset of the classes section.
+        std::uint64_t tableOff;         ///< Offset of the table section.
+        std::uint64_t finOff;           ///< Offset of the fin section.
+        std::uint64_t size;             ///< Size of the whole image.
+        std::uint64_t checksum;         ///< Checksum of the image.
+    }; // struct Header
+
+public:
+
+    /// Writes the image of the automaton \a dfa to the file \a path.
+    /// \throws DfaImageError if the file cannot be written.
+    static void save(const SpecCompiledDfa& dfa, const std::string& path)
+    {
+        const size_t statesNum = dfa.getStatesNum();
+        const size_t classesNum = dfa.getClassesNum();
+
+        Header h;
+        std::memset(&h, 0, sizeof(h));
+        std::memcpy(h.magic, Magic, sizeof(h.magic));
+        h.version = Version;
+        h.byteOrder = ByteOrderMark;
+        h.stateSize = sizeof(State);
+        h.alphaSize = sizeof(Alpha);
+        h.indexSize = sizeof(Index);
+        h.init = dfa._init;
+        h.statesNum = statesNum;
+        h.symbolsNum = dfa._symbolsNum;
+        h.classesNum = classesNum;
+        h.statesOff = alignUp(sizeof(Header));
+        h.classesOff = alignUp(h.statesOff + statesNum * sizeof(State));
+        h.tableOff = alignUp(h.classesOff + ClassesSize);
+        h.finOff = alignUp(h.tableOff + statesNum * classesNum * sizeof(Index));
+        h.size = h.finOff + finSize(statesNum);
+
+        std::vector<char> img(h.size, 0);
+        std::memcpy(&img[h.statesOff], dfa._states.values(),
+                    statesNum * sizeof(State));
+        std::memcpy(&img[h.classesOff], dfa._classes.table(), ClassesSize);
+        std::memcpy(&img[h.tableOff], dfa._table.data(),
+                    dfa._table.size() * sizeof(Index));
+        std::memcpy(&img[h.finOff], dfa._fin.data(), finSize(statesNum));
+        std::memcpy(&img[0], &h, sizeof(h));
+
+        h.checksum = checksum(img.data(), img.size());
+        std::memcpy(&img[0], &h, sizeof(h));
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(img.data(), std::streamsize(img.size()));
+        out.close();
+        if (!out)
+            throw DfaImageError(path + ": cannot write a DFA image");
+    }
+
+    /// Loads the image of an automaton from the file \a path; the checksum is
+    /// verified unless \a verify is false, which saves hashing the whole file.
+    /// The entries of the classes and the table are checked anyway.
+    /// \throws std::system_error if the file cannot be mapped.
+    /// \throws DfaImageError if the file is not a valid image or is written
+    /// for other types or byte order.
+    static SpecCompiledDfa load(const std::string& path, bool verify = true)
+    {
+        std::shared_ptr<MappedFile> file =
+                std::make_shared<MappedFile>(path, MappedFile::Access::Random);
+        const char* img = file->data();
+
+        Header h;
+        if (file->size() < sizeof(h))
+            throw DfaImageError(path + ": not a DFA image");
+        std::memcpy(&h, img, sizeof(h));
+
+        if (std::memcmp(h.magic, Magic, sizeof(h.magic)) != 0)
+            throw DfaImageError(path + ": not a DFA image");
+        if (h.version != Version)
+            throw DfaImageError(path + ": unsupported DFA image version "
+                                + std::to_string(h.version));
+        if (h.byteOrder != ByteOrderMark || h.stateSize != sizeof(State)
+                || h.alphaSize != sizeof(Alpha) || h.indexSize != sizeof(Index))
+            throw DfaImageError(path + ": DFA image of incompatible types");
+        if (h.size != file->size())
+            throw DfaImageError(path + ": DFA image is truncated");
+
+        // sizes of the sections, the states must have indices other than
+        // the sentinels
+        std::uint64_t statesSize, tableLen, tableSize;
+        if (h.statesNum == 0 || h.statesNum >= NoInternId
+                || h.init >= h.statesNum || h.classesNum > ClassMapRange
+                || !multiply(h.statesNum, sizeof(State), statesSize)
+                || !multiply(h.statesNum, h.classesNum, tableLen)
+                || !multiply(tableLen, sizeof(Index), tableSize)
+                || !isSection(h, h.statesOff, statesSize)
+                || !isSection(h, h.classesOff, ClassesSize)
+                || !isSection(h, h.tableOff, tableSize)
+                || !isSection(h, h.finOff, finSize(h.statesNum)))
+            throw DfaImageError(path + ": DFA image is corrupted");
+
+        if (verify && checksum(img, file->size()) != h.checksum)
+            throw DfaImageError(path + ": DFA image checksum mismatch");
+
+        // every entry must index a class or a state, or be a sentinel
+        const Index* classes = reinterpret_cast<const Index*>(
+                    img + h.classesOff);
+        const Index* table = reinterpret_cast<const Index*>(img + h.tableOff);
+        if (!isInRange(classes, ClassMapRange, h.classesNum, NoInternId)
+                || !isInRange(table, tableLen, h.statesNum,
+                              SpecCompiledDfa::NoTrans))
+            throw DfaImageError(path + ": DFA image is corrupted");
+
+        SpecCompiledDfa dfa;
+        dfa._states = typename SpecCompiledDfa::StateInterner(FlatArray<State>(
+                    reinterpret_cast<const State*>(img + h.statesOff),
+                    h.statesNum));
+        dfa._classes = typename SpecCompiledDfa::SymbolClassMap(
+                    FlatArray<Index>(classes, ClassMapRange));
+        dfa._symbolsNum = h.symbolsNum;
+        dfa._classesNum = h.classesNum;
+        dfa._table = FlatArray<Index>(table, tableLen);
+        dfa._fin = FlatArray<std::uint64_t>(
+                    reinterpret_cast<const std::uint64_t*>(img + h.finOff),
+                    SpecCompiledDfa::getFinWordsNum(h.statesNum));
+        dfa._init = h.init;
+        dfa._storage = file;
+
+        return dfa;
+    }
+
+protected:
+    /// Magic bytes opening an image.
+    static constexpr char Magic[8] = { 'F', 'S', 'A', 'D', 'F', 'A', 0, 0 };
+
+    /// Value revealing the byte order of the writer.
+    static constexpr std::uint32_t ByteOrderMark = 0x01020304;
+
+    /// Size of the direct table of symbol classes in entries.
+    static constexpr size_t ClassMapRange = ClassMap<Alpha>::Range;
+
+    /// Size of the classes section in bytes.
+    static constexpr size_t ClassesSize = ClassMapRange * sizeof(Index);
+
+    /// \return \a off rounded up to a multiple of Align.
+    static std::uint64_t alignUp(std::uint64_t off)
+    {
+        return (off + Align - 1) / Align * Align;
+    }
+
+    /// \return size of the fin section of \a statesNum states in bytes.
+    static size_t finSize(size_t statesNum)
+    {
+        return SpecCompiledDfa::getFinWordsNum(statesNum)
+                * sizeof(std::uint64_t);
+    }
+
+    /// Multiplies \a a by \a b into \a res.
+    /// \return false if the product overflows.
+    static bool multiply(std::uint64_t a, std::uint64_t b, std::uint64_t& res)
+    {
+        if (b != 0 && a > ~std::uint64_t(0) / b)
+            return false;
+        res = a * b;
+
+        return true;
+    }
+
+    /// \return true if each of \a len entries at \a data is less than \a num
+    /// or equal to \a sentinel.
+    static bool isInRange(const Index* data, std::uint64_t len,
+                          std::uint64_t num, Index sentinel)
+    {
+        // a branchless pass over the whole section
+        bool ok = true;
+        for (std::uint64_t i = 0; i < len; ++i)
+            ok &= (data[i] < num) | (data[i] == sentinel);
+
+        return ok;
+    }
+
+    /// \return true if the section of \a len bytes at the offset \a off is
+    /// aligned and lies within the image described by \a h.
+    static bool isSection(const Header& h, std::uint64_t off, std::uint64_t len)
+    {
+        return off % Align == 0 && off >= sizeof(Header) && off <= h.size
+                && len <= h.size - off;
+    }
+
+    /// \return checksum of the image of \a size bytes at \a img, which skips
+    /// the checksum field of the header.
+    static std::uint64_t checksum(const char* img, size_t size)
+    {
+        const size_t skip = offsetof(Header, checksum);
+
+        std::uint64_t hash = fnv1a(14695981039346656037ull, img, skip);
+        return fnv1a(hash, img + skip + sizeof(std::uint64_t),
+                     size - skip - sizeof(std::uint64_t));
+    }
+
+    /// \return FNV-1a hash \a hash continued by \a size bytes at \a data.
+    static std::uint64_t fnv1a(std::uint64_t hash, const char* data, size_t size)
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            hash ^= std::uint64_t(static_cast<unsigned char>(data[i]));
+            hash *= 1099511628211ull;
+        }
+
+        return hash;
+    }
+}; // class DfaImage
+
+
+
+#endif // DFA_IMAGE_HPP_
@@ -0,0 +1,200 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains declarations of the types for unanchored search.
+/// \author     DFA library contributors
+/// \version    0.1.0
+/// \date       16.10.2026
+/// \copyright  © DFA library contributors 2026.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef DFA_SEARCH_HPP_
+#define DFA_SEARCH_HPP_
+
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "dfa.hpp"
+#include "nfa.hpp"
+#include "compiled_dfa.hpp"
+
+
+
+/// Builds a DFA for the language \a Sigma* L(dfa): it is in an accepting
+/// state exactly after a word having a suffix accepted by \a dfa. The result
+/// has a transition from every state on every symbol of the alphabet.
+template<typename State, typename Alpha>
+Dfa<int, Alpha> makeSearchDfa(const Dfa<State, Alpha>& dfa)
+{
+    Interner<State> states(dfa.getStates().begin(), dfa.getStates().end());
+    const int start = int(states.size());
+
+    Nfa<int, Alpha> nfa;
+    nfa.setInitState(start);
+    for (Alpha a : dfa.getAlphabet())
+        nfa.addTrans(start, a, start);
+    if (states.size() != 0)
+        nfa.addEpsTrans(start, int(states.find(dfa.getInitState())));
+
+    for (const auto& t : dfa.getTransTable())
+    {
+        nfa.addTrans(int(states.find(t.first.first)), t.first.second,
+                     int(states.find(t.second)));
+    }
+    for (State s : dfa.getFinStates())
+        nfa.addFinState(int(states.find(s)));
+
+    return nfa.determinize();
+}
+
+
+/*! ****************************************************************************
+ *  \brief DfaSearcher finds every end offset of a match of a DFA language in
+ *  a sequence.
+ *
+ *  Matching is restarted at every position implicitly, by a `.*` prefix
+ *  built into the searching automaton, so a sequence is scanned only once.
+ *  A symbol out of the alphabet breaks off all the current matches.
+ *
+ *  An end offset of a match is the number of symbols from the beginning of
+ *  the sequence to the end of the match; if the empty word is in the
+ *  language, offset 0 is reported too. Offsets are delivered in ascending
+ *  order by batches to a sink, a callable `sink(const uint64_t* offs, size_t n)`.
+ *
+ *  \tparam Alpha represent elements of the alphabet of an automaton.
+ ******************************************************************************/
+template<typename Alpha>
+class DfaSearcher {
+public:
+    typedef Alpha TAlpha;
+
+    /// Compiled searching automaton.
+    typedef CompiledDfa<int, Alpha> SpecCompiledDfa;
+
+    /// Index type of the compiled DFA.
+    typedef typename SpecCompiledDfa::Index Index;
+
+    /// Number of offsets delivered to a sink at once (at most).
+    static constexpr size_t BatchSize = 256;
+
+public:
+    // Constructors and all.
+
+    /// Makes a searcher of words of the language of \a dfa.
+    template<typename State>
+    explicit DfaSearcher(const Dfa<State, Alpha>& dfa)
+        : _dfa(makeSearchDfa(dfa))
+        , _batchLen(0)
+    {
+        begin();
+    }
+
+public:
+
+    /// Searches the sequence of \a len symbols at \a seq and delivers
+    /// the end offsets of all matches to the \a sink.
+    template<typename Sink>
+    void search(const Alpha* seq, size_t len, Sink&& sink)
+    {
+        begin();
+        feed(seq, len, sink);
+        finish(sink);
+    }
+
+    /// Searches the sequence \a seq and delivers the end offsets of all
+    /// matches to the \a sink.
+    template<typename Traits, typename Sink>
+    void search(std::basic_string_view<Alpha, Traits> seq, Sink&& sink)
+    {
+        search(seq.data(), seq.size(), sink);
+    }
+
+    /// Searches the sequence of \a len symbols at \a seq and appends the end
+    /// offsets of all matches to \a offs.
+    /// \return number of matches found.
+    size_t search(const Alpha* seq, size_t len, std::vector<std::uint64_t>& offs)
+    {
+        size_t was = offs.size();
+        search(seq, len, [&offs](const std::uint64_t* o, size_t n)
+                         { offs.insert(offs.end(), o, o + n); });
+
+        return offs.size() - was;
+    }
+
+    // Streaming search: begin(), feed() any number of chunks, finish().
+
+    /// Starts searching a sequence that is fed by chunks.
+    void begin()
+    {
+        _curState = _dfa.getInitIndex();
+        _curPos = 0;
+        _batchLen = 0;
+        if (_dfa.isFinIndex(_curState))
+            _batch[_batchLen++] = 0;
+    }
+
+    /// Searches the next chunk of \a len symbols at \a chunk; full batches of
+    /// offsets are delivered to the \a sink.
+    template<typename Sink>
+    void feed(const Alpha* chunk, size_t len, Sink&& sink)
+    {
+        const Index init = _dfa.getInitIndex();
+        Index s = _curState;
+        for (size_t i = 0; i < len; ++i)
+        {
+            Index c;
+            s = _dfa.getSymbolClass(chunk[i], c) ? _dfa.getTransIndex(s, c)
+                                                 : init;
+            if (_dfa.isFinIndex(s))
+            {
+                _batch[_batchLen++] = _curPos + i + 1;
+                if (_batchLen == BatchSize)
+                    flush(sink);
+            }
+        }
+        _curState = s;
+        _curPos += len;
+    }
+
+    /// Finishes searching and delivers the rest of offsets to the \a sink.
+    template<typename Sink>
+    void finish(Sink&& sink)
+    {
+        if (_batchLen != 0)
+            flush(sink);
+    }
+
+    /// \return number of symbols searched since begin().
+    std::uint64_t getCurPos() const { return _curPos; }
+
+    /// \return the compiled searching automaton.
+    const SpecCompiledDfa& getDfa() const { return _dfa; }
+
+protected:
+    template<typename Sink>
+    void flush(Sink& sink)
+    {
+        sink(static_cast<const std::uint64_t*>(_batch), _batchLen);
+        _batchLen = 0;
+    }
+
+protected:
+    SpecCompiledDfa _dfa;               ///< Searching automaton.
+    Index _curState;                    ///< Index of the current state.
+    std::uint64_t _curPos;              ///< Number of searched symbols.
+
+    std::uint64_t _batch[BatchSize];    ///< Offsets not delivered yet.
+    size_t _batchLen;                   ///< Number of offsets in the batch.
+}; // class DfaSearcher
+
+
+
+#endif // DFA_SEARCH_HPP_
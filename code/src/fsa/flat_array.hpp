@@ -0,0 +1,207 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains declarations of the type for flat read-only arrays.
+/// \author     DFA library contributors
+/// \version    0.1.0
+/// \date       16.10.2026
+/// \copyright  © DFA library contributors 2026.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef FLAT_ARRAY_HPP_
+#define FLAT_ARRAY_HPP_
+
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+
+
+/*! ****************************************************************************
+ *  \brief FlatArray is a read-only array that either owns its elements or
+ *  refers to elements stored elsewhere, e.g. in a memory-mapped file.
+ *
+ *  Copying an owning array copies the elements, copying a referring one
+ *  copies the reference only, so the referred memory must outlive all
+ *  the copies.
+ *
+ *  \tparam T is a type of elements.
+ ******************************************************************************/
+template<typename T>
+class FlatArray {
+public:
+    typedef T TValue;
+
+public:
+    // Constructors and all.
+
+    /// Default constructor makes an empty array.
+    FlatArray()
+        : _data(nullptr)
+        , _size(0)
+    {
+    }
+
+    /// Makes an array owning the elements of \a v.
+    explicit FlatArray(std::vector<T> v)
+        : _own(std::move(v))
+        , _data(_own.data())
+        , _size(_own.size())
+    {
+    }
+
+    /// Makes an array referring to \a size elements stored at \a data.
+    FlatArray(const T* data, size_t size)
+        : _data(data)
+        , _size(size)
+    {
+    }
+
+    FlatArray(const FlatArray& other)
+        : _own(other._own)
+        , _data(other.isOwning() ? _own.data() : other._data)
+        , _size(other._size)
+    {
+    }
+
+    FlatArray(FlatArray&& other)
+        : _data(other._data)
+        , _size(other._size)
+    {
+        // moving a vector keeps its buffer, so _data stays valid
+        _own.swap(other._own);
+        other._data = nullptr;
+        other._size = 0;
+    }
+
+    FlatArray& operator=(FlatArray other)
+    {
+        _own.swap(other._own);
+        std::swap(_data, other._data);
+        std::swap(_size, other._size);
+        return *this;
+    }
+
+public:
+
+    /// \return number of elements.
+    size_t size() const { return _size; }
+
+    /// \return address of the first element.
+    const T* data() const { return _data; }
+
+    const T* begin() const { return _data; }
+    const T* end() const { return _data + _size; }
+
+    const T& operator[](size_t i) const { return _data[i]; }
+
+    /// \return true if the array owns its elements.
+    bool isOwning() const { return _data == _own.data(); }
+
+protected:
+    std::vector<T> _own;                ///< Owned elements, if any.
+    const T* _data;                     ///< Address of the elements.
+    size_t _size;                       ///< Number of the elements.
+}; // class FlatArray
+
+
+
+/*! ****************************************************************************
+ *  \brief FlatArray of bools.
+ *
+ *  `std::vector<bool>` packs its elements into bits and has no data(), so
+ *  owned elements are kept in a plain array of bools instead.
+ ******************************************************************************/
+template<>
+class FlatArray<bool> {
+public:
+    typedef bool TValue;
+
+public:
+    // Constructors and all.
+
+    /// Default constructor makes an empty array.
+    FlatArray()
+        : _data(nullptr)
+        , _size(0)
+    {
+    }
+
+    /// Makes an array owning the elements of \a v.
+    explicit FlatArray(const std::vector<bool>& v)
+        : _own(new bool[v.size()])
+        , _data(_own.get())
+        , _size(v.size())
+    {
+        std::copy(v.begin(), v.end(), _own.get());
+    }
+
+    /// Makes an array referring to \a size elements stored at \a data.
+    FlatArray(const bool* data, size_t size)
+        : _data(data)
+        , _size(size)
+    {
+    }
+
+    FlatArray(const FlatArray& other)
+        : _data(other._data)
+        , _size(other._size)
+    {
+        if (other.isOwning())
+        {
+            _own.reset(new bool[_size]);
+            std::copy(other.begin(), other.end(), _own.get());
+            _data = _own.get();
+        }
+    }
+
+    FlatArray(FlatArray&& other)
+        : _own(std::move(other._own))
+        , _data(other._data)
+        , _size(other._size)
+    {
+        other._data = nullptr;
+        other._size = 0;
+    }
+
+    FlatArray& operator=(FlatArray other)
+    {
+        _own.swap(other._own);
+        std::swap(_data, other._data);
+        std::swap(_size, other._size);
+        return *this;
+    }
+
+public:
+
+    /// \return number of elements.
+    size_t size() const { return _size; }
+
+    /// \return address of the first element.
+    const bool* data() const { return _data; }
+
+    const bool* begin() const { return _data; }
+    const bool* end() const { return _data + _size; }
+
+    const bool& operator[](size_t i) const { return _data[i]; }
+
+    /// \return true if the array owns its elements.
+    bool isOwning() const { return _data == _own.get(); }
+
+protected:
+    std::unique_ptr<bool[]> _own;       ///< Owned elements, if any.
+    const bool* _data;                  ///< Address of the elements.
+    size_t _size;                       ///< Number of the elements.
+}; // class FlatArray<bool>
+
+
+
+#endif // FLAT_ARRAY_HPP_
@@ -0,0 +1,248 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains declarations of the types for profiling replays.
+/// \author     DFA library contributors
+/// \version    0.1.0
+/// \date       16.10.2026
+/// \copyright  © DFA library contributors 2026.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef HEAT_MAP_HPP_
+#define HEAT_MAP_HPP_
+
+
+#include <algorithm>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+#include "compiled_dfa.hpp"
+
+
+
+/*! ****************************************************************************
+ *  \brief DfaHeatMap counts how often transitions and states of a compiled DFA
+ *  are used by replays.
+ *
+ *  Transition counters are a parallel array to the transition table, indexed
+ *  by the same slot `s * classes + c`. Counters are filled in by players with
+ *  HeatMapListener; a player with NullListener instead has no overhead.
+ *
+ *  \tparam State is a data type for representing states.
+ *  \tparam Alpha represent elements of the alphabet of an automaton.
+ ******************************************************************************/
+template<typename State, typename Alpha>
+class DfaHeatMap {
+public:
+    /// Specified compiled DFA.
+    typedef CompiledDfa<State, Alpha> SpecCompiledDfa;
+
+    /// Index type of the compiled DFA.
+    typedef typename SpecCompiledDfa::Index Index;
+
+    /// Counter of a transition.
+    struct TransHeat {
+        Index from;                     ///< Index of the source state.
+        Index cls;                      ///< Class of symbols.
+        Index to;                       ///< Index of the destination state.
+        std::uint64_t hits;             ///< Number of times fired.
+    }; // struct TransHeat
+
+public:
+    // Constructors and all.
+
+    /// Makes zero counters for the automaton \a dfa.
+    explicit DfaHeatMap(const SpecCompiledDfa& dfa)
+        : _dfa(dfa)
+        , _transHits(dfa.getStatesNum() * dfa.getClassesNum(), 0)
+        , _stateVisits(dfa.getStatesNum(), 0)
+        , _replaysNum(0)
+        , _noTransNum(0)
+        , _noTransPathsLen(0)
+    {
+    }
+
+public:
+
+    /// Resets all the counters.
+    void reset()
+    {
+        std::fill(_transHits.begin(), _transHits.end(), 0);
+        std::fill(_stateVisits.begin(), _stateVisits.end(), 0);
+        _replaysNum = 0;
+        _noTransNum = 0;
+        _noTransPathsLen = 0;
+    }
+
+    /// \return the automaton profiled.
+    const SpecCompiledDfa& getDfa() const { return _dfa; }
+
+    /// \return number of times the transition from the state \a s by
+    /// the class \a c has been fired.
+    std::uint64_t getTransHits(Index s, Index c) const
+    {
+        return _transHits[s * _dfa.getClassesNum() + c];
+    }
+
+    /// \return number of times the state \a s has been entered, including
+    /// starts of replays in the init state.
+    std::uint64_t getStateVisits(Index s) const { return _stateVisits[s]; }
+
+    /// \return number of replays started.
+    std::uint64_t getReplaysNum() const { return _replaysNum; }
+
+    /// \return number of replays broken off on a missing transition.
+    std::uint64_t getNoTransNum() const { return _noTransNum; }
+
+    /// \return average number of symbols replayed before a missing
+    /// transition, over the replays broken off.
+    double getAvgNoTransPathLen() const
+    {
+        return _noTransNum ? double(_noTransPathsLen) / double(_noTransNum)
+                           : 0.0;
+    }
+
+    /// \return at most \a n most fired transitions, the hottest first.
+    std::vector<TransHeat> getTopTrans(size_t n) const
+    {
+        const size_t classesNum = _dfa.getClassesNum();
+        std::vector<TransHeat> res;
+        for (size_t i = 0; i < _transHits.size(); ++i)
+        {
+            if (_transHits[i] != 0)
+            {
+                Index s = Index(i / classesNum);
+                Index c = Index(i % classesNum);
+                res.push_back({s, c, _dfa.getTransIndex(s, c), _transHits[i]});
+            }
+        }
+
+        n = std::min(n, res.size());
+        std::partial_sort(res.begin(), res.begin() + n, res.end(),
+                          [](const TransHeat& a, const TransHeat& b)
+                          { return a.hits > b.hits
+                                   || (a.hits == b.hits && a.from < b.from); });
+        res.resize(n);
+
+        return res;
+    }
+
+    /// Writes a report of the \a n hottest transitions and states, the visit
+    /// distribution and the paths broken off to \a out.
+    void report(std::ostream& out, size_t n) const
+    {
+        std::uint64_t total = 0;
+        for (std::uint64_t v : _stateVisits)
+            total += v;
+
+        out << "replays: " << _replaysNum << ", broken off: " << _noTransNum
+            << ", avg path before no transition: " << getAvgNoTransPathLen()
+            << '\n';
+
+        out << "top transitions:\n";
+        for (const TransHeat& t : getTopTrans(n))
+        {
+            out << "  " << _dfa.getState(t.from) << " -[class " << t.cls
+                << "]-> " << _dfa.getState(t.to) << ": " << t.hits << '\n';
+        }
+
+        // states ordered by visits
+        std::vector<Index> order;
+        size_t unvisited = 0;
+        for (Index s = 0; s < _stateVisits.size(); ++s)
+        {
+            if (_stateVisits[s] != 0)
+                order.push_back(s);
+            else
+                ++unvisited;
+        }
+        std::stable_sort(order.begin(), order.end(), [this](Index a, Index b)
+                         { return _stateVisits[a] > _stateVisits[b]; });
+
+        out << "top states:\n";
+        std::uint64_t covered = 0;
+        for (size_t i = 0; i < order.size() && i < n; ++i)
+        {
+            covered += _stateVisits[order[i]];
+            out << "  " << _dfa.getState(order[i]) << ": "
+                << _stateVisits[order[i]] << " ("
+                << 100.0 * double(covered) / double(total) << "% cumulative)\n";
+        }
+        out << "states visited: " << order.size() << ", never visited: "
+            << unvisited << '\n';
+    }
+
+protected:
+    template<typename S, typename A>
+    friend class HeatMapListener;
+
+protected:
+    const SpecCompiledDfa& _dfa;        ///< Ref to the automaton.
+    std::vector<std::uint64_t> _transHits;      ///< Counters per slot.
+    std::vector<std::uint64_t> _stateVisits;    ///< Counters per state.
+    std::uint64_t _replaysNum;          ///< Number of replays.
+    std::uint64_t _noTransNum;          ///< Number of broken replays.
+    std::uint64_t _noTransPathsLen;     ///< Total length of broken replays.
+}; // class DfaHeatMap
+
+
+/*! ****************************************************************************
+ *  \brief Listener policy for BasicCompiledDfaPlayer that counts transitions
+ *  and states in a DfaHeatMap.
+ *
+ *  Several players, one at a time, may count into the same heat map.
+ *
+ *  \tparam State is a data type for representing states.
+ *  \tparam Alpha represent elements of the alphabet of an automaton.
+ ******************************************************************************/
+template<typename State, typename Alpha>
+class HeatMapListener {
+public:
+    /// Heat map the counters are in.
+    typedef DfaHeatMap<State, Alpha> SpecHeatMap;
+
+    /// Index type of the compiled DFA.
+    typedef typename SpecHeatMap::Index Index;
+
+public:
+    /// Makes a listener counting in the \a heat map.
+    explicit HeatMapListener(SpecHeatMap& heat)
+        : _heat(&heat)
+        , _classesNum(heat.getDfa().getClassesNum())
+    {
+    }
+
+    void onStateChanging(Index /*preS*/, Index newS)
+    {
+        ++_heat->_replaysNum;
+        ++_heat->_stateVisits[newS];
+    }
+
+    void onTransFired(std::uint64_t /*pos*/, Index s, Alpha /*a*/, Index c,
+                      Index d)
+    {
+        ++_heat->_transHits[s * _classesNum + c];
+        ++_heat->_stateVisits[d];
+    }
+
+    void onNoTrans(std::uint64_t pos, Index /*s*/, Alpha /*a*/)
+    {
+        ++_heat->_noTransNum;
+        _heat->_noTransPathsLen += pos;
+    }
+
+protected:
+    SpecHeatMap* _heat;                 ///< Heat map of counters.
+    size_t _classesNum;                 ///< Width of a row of the table.
+}; // class HeatMapListener
+
+
+
+#endif // HEAT_MAP_HPP_
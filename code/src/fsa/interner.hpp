@@ -0,0 +1,288 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains declarations of the types for interning values.
+/// \author     DFA library contributors
+/// \version    0.1.0
+/// \date       16.10.2026
+/// \copyright  © DFA library contributors 2026.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef INTERNER_HPP_
+#define INTERNER_HPP_
+
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "flat_array.hpp"
+
+
+/// Dense identifier of an interned value.
+typedef std::uint32_t InternId;
+
+/// Sentinel denoting a value that has not been interned.
+constexpr InternId NoInternId = ~InternId(0);
+
+
+/*! ****************************************************************************
+ *  \brief Interner maps a finite set of ordered values to contiguous ids.
+ *
+ *  Ids are assigned in the ascending order of values, so the id of the least
+ *  value is 0 and the id of the greatest one is size() - 1. The set of values
+ *  is fixed at construction time.
+ *
+ *  The general version keeps the values in a sorted vector and looks them up
+ *  by binary search, so \a T is only required to be less-than comparable.
+ *
+ *  \tparam T is a type of interned values.
+ ******************************************************************************/
+template<typename T, typename Enable = void>
+class Interner {
+public:
+    typedef T TValue;
+
+public:
+    // Constructors and all.
+
+    /// Default constructor makes an empty interner.
+    Interner() = default;
+
+    /// Interns the values of the range [\a first, \a last). Duplicates are
+    /// allowed.
+    template<typename It>
+    Interner(It first, It last)
+    {
+        std::vector<T> values(first, last);
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end(),
+                                 [](const T& a, const T& b)
+                                 { return !(a < b) && !(b < a); }),
+                     values.end());
+        _values = FlatArray<T>(std::move(values));
+    }
+
+    /// Interns the \a values, which must be sorted and unique already; they
+    /// are looked up in place.
+    explicit Interner(FlatArray<T> values)
+        : _values(std::move(values))
+    {
+    }
+
+public:
+
+    /// \return number of interned values.
+    size_t size() const { return _values.size(); }
+
+    /// \return id of the value \a v, or NoInternId if \a v is not interned.
+    InternId find(const T& v) const
+    {
+        auto it = std::lower_bound(_values.begin(), _values.end(), v);
+        if (it == _values.end() || v < *it)
+            return NoInternId;
+
+        return InternId(it - _values.begin());
+    }
+
+    /// \return value with the id \a id.
+    const T& value(InternId id) const { return _values[id]; }
+
+    /// \return all the values ordered by their ids.
+    const T* values() const { return _values.data(); }
+
+protected:
+    FlatArray<T> _values;               ///< Values ordered by their ids.
+}; // class Interner
+
+
+/*! ****************************************************************************
+ *  \brief Interner for small integral types (e.g. char).
+ *
+ *  Besides the sorted vector of values, keeps a direct table indexed by a
+ *  value itself, so a lookup is a single array access.
+ ******************************************************************************/
+template<typename T>
+class Interner<T, typename std::enable_if<std::is_integral<T>::value
+                                          && !std::is_same<T, bool>::value
+                                          && sizeof(T) <= 2>::type> {
+public:
+    typedef T TValue;
+
+public:
+    // Constructors and all.
+
+    /// Default constructor makes an empty interner.
+    Interner()
+        : _ids(Range, NoInternId)
+    {
+    }
+
+    /// Interns the values of the range [\a first, \a last). Duplicates are
+    /// allowed.
+    template<typename It>
+    Interner(It first, It last)
+    {
+        std::vector<T> values(first, last);
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+        _values = FlatArray<T>(std::move(values));
+        fillIds();
+    }
+
+    /// Interns the \a values, which must be sorted and unique already; only
+    /// the direct table is built.
+    explicit Interner(FlatArray<T> values)
+        : _values(std::move(values))
+    {
+        fillIds();
+    }
+
+public:
+
+    /// \return number of interned values.
+    size_t size() const { return _values.size(); }
+
+    /// \return id of the value \a v, or NoInternId if \a v is not interned.
+    InternId find(T v) const { return _ids[slot(v)]; }
+
+    /// \return value with the id \a id.
+    const T& value(InternId id) const { return _values[id]; }
+
+    /// \return all the values ordered by their ids.
+    const T* values() const { return _values.data(); }
+
+protected:
+    /// Number of distinct values of the type T.
+    static constexpr size_t Range = size_t(1) << (sizeof(T) * 8);
+
+    /// \return position of the value \a v in the direct table.
+    static size_t slot(T v)
+    {
+        return size_t(std::make_unsigned_t<T>(v));
+    }
+
+    /// Builds the direct table of ids of the values.
+    void fillIds()
+    {
+        _ids.assign(Range, NoInternId);
+        for (size_t i = 0; i < _values.size(); ++i)
+            _ids[slot(_values[i])] = InternId(i);
+    }
+
+protected:
+    FlatArray<T> _values;               ///< Values ordered by their ids.
+    std::vector<InternId> _ids;         ///< Direct table of ids.
+}; // class Interner
+
+
+
+/*! ****************************************************************************
+ *  \brief ClassMap maps interned values to ids of their classes.
+ *
+ *  Several values may share the same class. Values that were not interned are
+ *  mapped to NoInternId.
+ *
+ *  \tparam T is a type of mapped values.
+ ******************************************************************************/
+template<typename T, typename Enable = void>
+class ClassMap {
+public:
+    typedef T TValue;
+
+public:
+    // Constructors and all.
+
+    /// Default constructor makes an empty map.
+    ClassMap() = default;
+
+    /// Maps every value interned by \a in to the class \a classes[id].
+    ClassMap(const Interner<T>& in, const std::vector<InternId>& classes)
+        : _in(in)
+        , _classes(classes)
+    {
+    }
+
+public:
+
+    /// \return class of the value \a v, or NoInternId if \a v is not mapped.
+    InternId find(const T& v) const
+    {
+        InternId id = _in.find(v);
+        return (id == NoInternId) ? NoInternId : _classes[id];
+    }
+
+protected:
+    Interner<T> _in;                    ///< Interned values.
+    std::vector<InternId> _classes;     ///< Classes of interned values.
+}; // class ClassMap
+
+
+/*! ****************************************************************************
+ *  \brief ClassMap for small integral types keeps a single direct table.
+ ******************************************************************************/
+template<typename T>
+class ClassMap<T, typename std::enable_if<std::is_integral<T>::value
+                                          && !std::is_same<T, bool>::value
+                                          && sizeof(T) <= 2>::type> {
+public:
+    typedef T TValue;
+
+public:
+    // Constructors and all.
+
+    /// Default constructor makes an empty map.
+    ClassMap()
+        : _classes(std::vector<InternId>(Range, NoInternId))
+    {
+    }
+
+    /// Maps every value interned by \a in to the class \a classes[id].
+    ClassMap(const Interner<T>& in, const std::vector<InternId>& classes)
+    {
+        std::vector<InternId> table(Range, NoInternId);
+        for (size_t i = 0; i < in.size(); ++i)
+            table[slot(in.value(InternId(i)))] = classes[i];
+        _classes = FlatArray<InternId>(std::move(table));
+    }
+
+    /// Makes a map of the direct \a table of Range classes, which is used
+    /// in place.
+    explicit ClassMap(FlatArray<InternId> table)
+        : _classes(std::move(table))
+    {
+    }
+
+public:
+    /// Number of distinct values of the type T, i.e. the size of the table.
+    static constexpr size_t Range = size_t(1) << (sizeof(T) * 8);
+
+public:
+
+    /// \return class of the value \a v, or NoInternId if \a v is not mapped.
+    InternId find(T v) const { return _classes[slot(v)]; }
+
+    /// \return the direct table of classes indexed by unsigned values.
+    const InternId* table() const { return _classes.data(); }
+
+protected:
+    /// \return position of the value \a v in the direct table.
+    static size_t slot(T v)
+    {
+        return size_t(std::make_unsigned_t<T>(v));
+    }
+
+protected:
+    FlatArray<InternId> _classes;       ///< Direct table of classes.
+}; // class ClassMap
+
+
+
+#endif // INTERNER_HPP_
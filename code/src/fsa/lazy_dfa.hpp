@@ -0,0 +1,479 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains declarations of the types for lazy DFAs.
+/// \author     DFA library contributors
+/// \version    0.1.0
+/// \date       16.10.2026
+/// \copyright  © DFA library contributors 2026.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef LAZY_DFA_HPP_
+#define LAZY_DFA_HPP_
+
+
+#include <algorithm>
+#include <set>
+#include <vector>
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+
+#include "nfa.hpp"
+
+
+
+/*! ****************************************************************************
+ *  \brief LazyDfa determinizes an NFA on demand.
+ *
+ *  A DFA state (a set of NFA states) and its transitions are built only when
+ *  a replay reaches them for the first time, and are kept in a cache. Once
+ *  the memory taken by the cache would exceed the given limit, the cache is
+ *  flushed, releasing all its storage, and refilled from the current state,
+ *  so the limit is never exceeded, unless a single state does not fit in it.
+ *  The memory counts the allocated capacities of the tables and the buckets
+ *  and nodes of the hash map, not only their contents.
+ *
+ *  Indices of cached states are valid until the next call of getTransIndex()
+ *  or getInitIndex(), which can flush the cache.
+ *
+ *  \tparam State is a data type for representing states of the NFA.
+ *  \tparam Alpha represent elements of the alphabet of an automaton.
+ ******************************************************************************/
+template<typename State, typename Alpha>
+class LazyDfa {
+public:
+    // aliases for State and Alpha
+    typedef State TState;
+    typedef Alpha TAlpha;
+
+    /// Specified NFA.
+    typedef Nfa<State, Alpha> SpecNfa;
+
+    /// Dense index of a cached state or a symbol.
+    typedef InternId Index;
+
+    /// Sentinel denoting the absence of a transition.
+    static constexpr Index NoTrans = ~Index(0);
+
+    /// Sentinel denoting a transition that has not been built yet.
+    static constexpr Index Unknown = ~Index(0) - 1;
+
+    /// Default memory limit of the cache in bytes.
+    static constexpr size_t DefMemLimit = size_t(1) << 20;
+
+public:
+    // Constructors and all.
+
+    /// Makes a lazy DFA for the automaton \a nfa with the cache taking
+    /// at most \a memLimit bytes.
+    explicit LazyDfa(const SpecNfa& nfa, size_t memLimit = DefMemLimit)
+        : _nfa(nfa)
+        , _symbolsNum(_nfa.getSymbolsNum())
+        , _memLimit(memLimit)
+        , _nodesMem(0)
+        , _flushesNum(0)
+        , _init(NoTrans)
+    {
+    }
+
+    // the cached sets are referred to by the keys of the map, so a copy
+    // would refer to the sets of its source
+    LazyDfa(const LazyDfa&) = delete;
+    LazyDfa& operator=(const LazyDfa&) = delete;
+    LazyDfa(LazyDfa&&) = delete;
+    LazyDfa& operator=(LazyDfa&&) = delete;
+
+public:
+
+    /// \return index of the init state, which is built if not cached.
+    Index getInitIndex()
+    {
+        if (_init == NoTrans)
+            _init = addState(_nfa.getInitClosure());
+
+        return _init;
+    }
+
+    /// Looks up the index of the symbol \a a.
+    /// \return true if \a a belongs to the alphabet, false otherwise.
+    bool getSymbolIndex(Alpha a, Index& c) const
+    {
+        c = _nfa.findSymbol(a);
+        return c != NoInternId;
+    }
+
+    /// \return index of the state reached from the state \a s by the symbol
+    /// with the index \a c, or NoTrans if there is no such transition.
+    Index getTransIndex(Index s, Index c)
+    {
+        Index d = _table[s * _symbolsNum + c];
+        if (d == Unknown)
+            d = build(s, c);
+
+        return d;
+    }
+
+    /// \return true if the cached state with the index \a s is accepting.
+    bool isFinIndex(Index s) const { return _fin[s] != 0; }
+
+    /// \return set of NFA states making up the cached state \a s.
+    std::set<State> getNfaStates(Index s) const
+    {
+        std::set<State> res;
+        for (Index q : *_sets[s])
+            res.insert(_nfa.getState(q));
+        return res;
+    }
+
+    /// \return number of cached states.
+    size_t getCachedStatesNum() const { return _sets.size(); }
+
+    /// \return number of bytes taken by the cache.
+    size_t getMemUsed() const
+    {
+        return _nodesMem + _table.capacity() * sizeof(Index)
+                + _sets.capacity() * sizeof(const StateSet*)
+                + _fin.capacity() + _ids.bucket_count() * sizeof(void*);
+    }
+
+    /// \return memory limit of the cache in bytes.
+    size_t getMemLimit() const { return _memLimit; }
+
+    /// \return number of times the cache has been flushed.
+    size_t getFlushesNum() const { return _flushesNum; }
+
+protected:
+    typedef typename CompiledNfa<State, Alpha>::StateSet StateSet;
+    typedef typename CompiledNfa<State, Alpha>::StateSetHash StateSetHash;
+
+    /// Map of sets of cached states to their indices.
+    typedef std::unordered_map<StateSet, Index, StateSetHash> IdMap;
+
+    /// \return number of bytes taken by the node of the hash map holding
+    /// a cached state made of \a ss, with its link and hash value.
+    static size_t nodeMem(const StateSet& ss)
+    {
+        return sizeof(typename IdMap::value_type) + sizeof(void*) * 2
+                + ss.capacity() * sizeof(Index);
+    }
+
+    /// \return capacity a vector of the capacity \a cap grows to for \a size
+    /// elements; vectors are grown only by reserve() with it.
+    static size_t grownCapacity(size_t cap, size_t size)
+    {
+        return (size <= cap) ? cap : std::max(size, cap * 2);
+    }
+
+    /// \return number of buckets of the hash map once it holds \a size
+    /// elements, overestimated if it has to grow.
+    size_t grownBucketsNum(size_t size) const
+    {
+        if (size <= _ids.bucket_count() * _ids.max_load_factor())
+            return _ids.bucket_count();
+
+        // reserve() rounds the number of buckets up to a prime
+        return size_t(size * 2 / _ids.max_load_factor()) * 9 / 8 + 16;
+    }
+
+    /// \return number of bytes the cache would take with a new state made of
+    /// \a ss.
+    size_t getMemWith(const StateSet& ss) const
+    {
+        size_t statesNum = _sets.size() + 1;
+        return _nodesMem + nodeMem(ss)
+                + grownCapacity(_table.capacity(), statesNum * _symbolsNum)
+                  * sizeof(Index)
+                + grownCapacity(_sets.capacity(), statesNum)
+                  * sizeof(const StateSet*)
+                + grownCapacity(_fin.capacity(), statesNum)
+                + grownBucketsNum(statesNum) * sizeof(void*);
+    }
+
+    /// Builds the transition from the state \a s by the symbol \a c.
+    Index build(Index s, Index c)
+    {
+        StateSet next;
+        _nfa.move(*_sets[s], c, next);
+        if (next.empty())
+        {
+            _table[s * _symbolsNum + c] = NoTrans;
+            return NoTrans;
+        }
+
+        auto it = _ids.find(next);
+        if (it != _ids.end())
+        {
+            _table[s * _symbolsNum + c] = it->second;
+            return it->second;
+        }
+
+        if (getMemWith(next) > _memLimit)
+        {
+            // the source state is gone, so the transition is not recorded
+            flush();
+            return addState(std::move(next));
+        }
+
+        Index d = addState(std::move(next));
+        _table[s * _symbolsNum + c] = d;
+        return d;
+    }
+
+    /// Adds a new state made of the set \a ss to the cache.
+    Index addState(StateSet ss)
+    {
+        _nodesMem += nodeMem(ss);
+
+        Index s = Index(_sets.size());
+        _table.reserve(grownCapacity(_table.capacity(),
+                                     (s + 1) * _symbolsNum));
+        _sets.reserve(grownCapacity(_sets.capacity(), s + 1));
+        _fin.reserve(grownCapacity(_fin.capacity(), s + 1));
+        if (s + 1 > _ids.bucket_count() * _ids.max_load_factor())
+            _ids.reserve(2 * (s + 1));
+        _fin.push_back(_nfa.hasFinIndex(ss) ? 1 : 0);
+        _table.resize(_table.size() + _symbolsNum, Unknown);
+        _sets.push_back(&_ids.insert({std::move(ss), s}).first->first);
+
+        return s;
+    }
+
+    /// Drops all the cached states.
+    void flush()
+    {
+        // clear() keeps the storage, swapping releases it
+        IdMap().swap(_ids);
+        std::vector<const StateSet*>().swap(_sets);
+        std::vector<Index>().swap(_table);
+        std::vector<char>().swap(_fin);
+        _nodesMem = 0;
+        _init = NoTrans;
+        ++_flushesNum;
+    }
+
+protected:
+    CompiledNfa<State, Alpha> _nfa;     ///< Frozen NFA.
+    size_t _symbolsNum;                 ///< Number of symbols.
+
+    /// Indices of cached states by their sets.
+    IdMap _ids;
+    std::vector<const StateSet*> _sets; ///< Sets of cached states.
+    std::vector<Index> _table;          ///< Flat table of cached transitions.
+    std::vector<char> _fin;             ///< Accepting flags per state.
+
+    size_t _memLimit;                   ///< Memory limit of the cache.
+    size_t _nodesMem;                   ///< Memory taken by the map nodes.
+    size_t _flushesNum;                 ///< Number of flushes.
+    Index _init;                        ///< Index of the init state if cached.
+}; // class LazyDfa
+
+
+template<typename State, typename Alpha>
+constexpr typename LazyDfa<State, Alpha>::Index LazyDfa<State, Alpha>::NoTrans;
+
+template<typename State, typename Alpha>
+constexpr typename LazyDfa<State, Alpha>::Index LazyDfa<State, Alpha>::Unknown;
+
+template<typename State, typename Alpha>
+constexpr size_t LazyDfa<State, Alpha>::DefMemLimit;
+
+
+/*! ****************************************************************************
+ *  \brief Player used to replay a given string in a lazy automaton.
+ *
+ *  Provides the same semantics as DfaPlayer does; the current state is a set
+ *  of states of the underlying NFA.
+ *
+ *  Several players may share a lazy automaton, but a flush of its cache,
+ *  which a step of any of them may cause, invalidates the current states of
+ *  all the others, so a player sharing the cache must not be asked about
+ *  its state or fed the next chunk after another one has replayed anything.
+ *
+ *  \tparam State is a data type for representing states of the NFA.
+ *  \tparam Alpha represent elements of the alphabet of an automaton.
+ ******************************************************************************/
+template<typename State, typename Alpha>
+class LazyDfaPlayer {
+public:
+    // aliases for State and Alpha
+    typedef State TState;
+    typedef Alpha TAlpha;
+
+    /// Specified lazy DFA.
+    typedef LazyDfa<State, Alpha> SpecLazyDfa;
+
+    /// Index type of the lazy DFA.
+    typedef typename SpecLazyDfa::Index Index;
+
+    /// Results of replaying (shared with DfaPlayer).
+    typedef PlayResult Result;
+
+public:
+    // Constructors and all.
+
+    /// Inititalizes a player with a lazy automaton, which is extended while
+    /// replaying.
+    explicit LazyDfaPlayer(SpecLazyDfa& dfa)
+        : _dfa(dfa)
+    {
+        _curPos = 0;            // nothing to replay
+        _noTrans = false;
+        _lastSymb = Alpha();
+    }
+
+public:
+
+    /// Plays a sequence given by the range [\a first, \a last) of input
+    /// iterators without copying it.
+    /// \return Result::ok if the sequence was replayed successfully (accepted),
+    /// otherwise it is declined. See DfaPlayer::play() for details.
+    template<typename InputIt>
+    Result play(InputIt first, InputIt last)
+    {
+        begin();
+        feed(first, last);
+
+        return finish();
+    }
+
+    /// Plays a sequence provided as a vector.
+    /// \return Result::ok if the \a seq was replayed successfully (accepted),
+    /// otherwise \a seq is declined. See DfaPlayer::play() for details.
+    Result play(const std::vector<Alpha>& seq)
+    {
+        return play(seq.begin(), seq.end());
+    }
+
+    /// Plays a sequence of \a len symbols stored at \a seq.
+    Result play(const Alpha* seq, size_t len)
+    {
+        return play(seq, seq + len);
+    }
+
+    /// Plays a sequence provided as a string view.
+    template<typename Traits>
+    Result play(std::basic_string_view<Alpha, Traits> seq)
+    {
+        return play(seq.begin(), seq.end());
+    }
+
+    // Streaming replay: begin(), feed() any number of chunks, finish().
+
+    /// Starts replaying a sequence that is fed by chunks.
+    void begin()
+    {
+        init();
+        _noTrans = false;
+    }
+
+    /// Replays the next chunk [\a first, \a last) of the sequence.
+    /// \return false if the replay has already broken off on a missing
+    /// transition, so the rest of the sequence can be dropped.
+    template<typename InputIt>
+    bool feed(InputIt first, InputIt last)
+    {
+        if (_noTrans)
+            return false;
+
+        for ( ; first != last; ++first)
+        {
+            if (!replaySymb(*first))
+            {
+                _noTrans = true;
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /// Replays the next chunk of \a len symbols stored at \a chunk.
+    bool feed(const Alpha* chunk, size_t len)
+    {
+        return feed(chunk, chunk + len);
+    }
+
+    /// Replays the next chunk provided as a string view.
+    template<typename Traits>
+    bool feed(std::basic_string_view<Alpha, Traits> chunk)
+    {
+        return feed(chunk.begin(), chunk.end());
+    }
+
+    /// Replays the next chunk provided as a vector.
+    bool feed(const std::vector<Alpha>& chunk)
+    {
+        return feed(chunk.begin(), chunk.end());
+    }
+
+    /// Finishes replaying the fed sequence.
+    /// \return the result as play() would return for the whole sequence.
+    Result finish() const
+    {
+        if (_noTrans)
+            return Result::NoTrans;
+
+        // check for the accepting state
+        if (!_dfa.isFinIndex(_curState))
+            return Result::NonFinState;
+
+        return Result::Ok;
+    }
+
+    /// Returns the set of NFA states being visited.
+    std::set<State> getCurStates() const { return _dfa.getNfaStates(_curState); }
+
+    /// Returns current position in the replayed sequence.
+    std::uint64_t getCurPos() const { return _curPos; }
+
+    /// Returns the last considered symbol.
+    Alpha getLastSymbol() const { return _lastSymb; }
+
+protected:
+
+    /// Initializes the player before the replay.
+    void init()
+    {
+        _curState = _dfa.getInitIndex();
+        _curPos = 0;
+        _lastSymb = Alpha();
+    }
+
+    /// Tries to replay another given symbol being in the current state.
+    /// \return true if the symbol can be replayed, false otherwise.
+    bool replaySymb(Alpha a)
+    {
+        _lastSymb = a;
+
+        Index c;
+        if (!_dfa.getSymbolIndex(a, c))
+            return false;
+
+        Index nextSt = _dfa.getTransIndex(_curState, c);
+        if (nextSt == SpecLazyDfa::NoTrans)
+            return false;
+
+        _curState = nextSt;
+        ++_curPos;
+
+        return true;
+    }
+
+protected:
+    SpecLazyDfa& _dfa;                  ///< Ref to the automaton.
+    Index _curState;                    ///< Index of the current state.
+    std::uint64_t _curPos;              ///< Currently replayed symbol.
+    bool _noTrans;                      ///< Replay has broken off.
+    Alpha _lastSymb;                    ///< Stores last replayed symbol.
+}; // class LazyDfaPlayer
+
+
+
+#endif // LAZY_DFA_HPP_
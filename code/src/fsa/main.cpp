@@ -14,12 +14,30 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 
+#include <chrono>
+#include <cstring>
+#include <exception>
 #include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
 
 #include "dfa.hpp"
+#include "auto_dfa.hpp"
+#include "compiled_dfa.hpp"
+#include "dfa_image.hpp"
+#include "mapped_file.hpp"
+#include "regex.hpp"
 
 typedef Dfa<int, char> IntCharDfa;
 typedef DfaPlayer<int, char> IntCharDfaPlayer;
+typedef CompiledDfa<int, char> IntCharCompiledDfa;
+typedef CompiledDfaPlayer<int, char> IntCharCompiledDfaPlayer;
+typedef DfaImage<int, char> IntCharDfaImage;
+typedef AutoDfa<int, char> IntCharAutoDfa;
+typedef AutoDfaPlayer<int, char> IntCharAutoDfaPlayer;
 
 
 // Create custom EventListener for a player to track changes in an automaton.
@@ -51,16 +69,117 @@ void test1()
     IntCharDfaPlayerEventListener cb;
     IntCharDfaPlayer player(dfa, &cb);
 
-    IntCharDfaPlayer::Result res = player.play({'1', '0', '1', '0'});
+    IntCharDfaPlayer::Result res = player.play(std::string_view("1010"));
 }
 
-int main()
+void printUsage(const char* prog)
 {
-    std::cout << "Let's do some deterministic automata!\n";
+    std::cerr << "Usage: " << prog << '\n'
+              << "       " << prog << " -e REGEX FILE...\n"
+              << "       " << prog << " -b IMAGE FILE...\n"
+              << "       " << prog << " -c REGEX IMAGE\n"
+              << "Without arguments runs a demo. Otherwise replays every FILE"
+                 " as a whole\nin the DFA compiled from REGEX or loaded from"
+                 " the binary IMAGE,\nor saves the DFA compiled from REGEX to"
+                 " IMAGE.\n";
+}
+
+/// Replays every file of \a files mapped into memory in the automaton \a dfa
+/// and reports the results.
+/// \return 0 if all the files are accepted, 1 if some are rejected, 2 if some
+/// cannot be read.
+int scanFiles(const IntCharCompiledDfa& dfa, const std::vector<std::string>& files)
+{
+    int rejected = 0;
+    int failed = 0;
+    IntCharAutoDfa adfa(dfa);           // an engine chosen for the DFA
+    IntCharAutoDfaPlayer player(adfa);
+    for (const std::string& path : files)
+    {
+        std::unique_ptr<MappedFile> mapped;
+        try
+        {
+            mapped.reset(new MappedFile(path, MappedFile::Access::Sequential));
+        }
+        catch (const std::system_error& e)
+        {
+            std::cerr << e.what() << '\n';
+            ++failed;
+            continue;
+        }
+        const MappedFile& file = *mapped;
+
+        auto start = std::chrono::steady_clock::now();
+        IntCharAutoDfaPlayer::Result res = player.play(file.data(), file.size());
+        double sec = std::chrono::duration<double>(
+                    std::chrono::steady_clock::now() - start).count();
+
+        std::cout << path << ": ";
+        switch (res)
+        {
+        case IntCharAutoDfaPlayer::Result::Ok:
+            std::cout << "accepted";
+            break;
+        case IntCharAutoDfaPlayer::Result::NoTrans:
+            std::cout << "rejected at position " << player.getCurPos()
+                      << " (no transition)";
+            break;
+        case IntCharAutoDfaPlayer::Result::NonFinState:
+            std::cout << "rejected at end (non-accepting state)";
+            break;
+        }
+        std::cout << ", " << file.size() << " bytes, "
+                  << (sec > 0 ? double(player.getCurPos()) / sec / 1e9 : 0.0)
+                  << " GB/s\n";
+
+        if (res != IntCharAutoDfaPlayer::Result::Ok)
+            ++rejected;
+    }
+
+    return failed ? 2 : (rejected ? 1 : 0);
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc == 1)
+    {
+        std::cout << "Let's do some deterministic automata!\n";
+
+        test1();
+
+        std::cout << "\n\nBye-bye!\n\n";
+        return 0;
+    }
+
+    const bool compile = argc == 4 && std::strcmp(argv[1], "-c") == 0;
+    const bool image = argc >= 4 && std::strcmp(argv[1], "-b") == 0;
+    if (!compile && !image && (argc < 4 || std::strcmp(argv[1], "-e") != 0))
+    {
+        printUsage(argv[0]);
+        return 2;
+    }
+
+    try
+    {
+        if (compile)
+        {
+            IntCharDfaImage::save(
+                        IntCharCompiledDfa(RegexCompiler::compile(argv[2])),
+                        argv[3]);
+            return 0;
+        }
 
-    test1();
+        IntCharCompiledDfa dfa = image
+                ? IntCharDfaImage::load(argv[2])
+                : IntCharCompiledDfa(RegexCompiler::compile(argv[2]));
+        std::vector<std::string> files(argv + 3, argv + argc);
 
-    std::cout << "\n\nBye-bye!\n\n";
-    return 0;
+        return scanFiles(dfa, files);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << argv[0] << ": " << e.what() << '\n';
+        return 2;
+    }
 }
 
@@ -0,0 +1,115 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains declarations of the type for memory-mapped files.
+/// \author     DFA library contributors
+/// \version    0.1.0
+/// \date       16.10.2026
+/// \copyright  © DFA library contributors 2026.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef MAPPED_FILE_HPP_
+#define MAPPED_FILE_HPP_
+
+
+#include <cerrno>
+#include <string>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+
+/*! ****************************************************************************
+ *  \brief MappedFile maps a whole file into memory for reading (POSIX only).
+ *
+ *  The mapping is shared, so processes mapping the same file share its
+ *  physical pages.
+ ******************************************************************************/
+class MappedFile {
+public:
+    /// Access patterns passed to madvise().
+    enum class Access {
+        Normal,             ///< No advice.
+        Sequential,         ///< Read ahead aggressively, free behind.
+        Random,             ///< Do not read ahead.
+    };
+
+public:
+    // Constructors and all.
+
+    /// Maps the file \a path advising the kernel of the \a access pattern.
+    /// \throws std::system_error if the file cannot be mapped.
+    explicit MappedFile(const std::string& path,
+                        Access access = Access::Sequential)
+        : _data(nullptr)
+        , _size(0)
+    {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            throw std::system_error(errno, std::generic_category(), path);
+
+        struct stat st;
+        if (::fstat(fd, &st) != 0)
+        {
+            int err = errno;
+            ::close(fd);
+            throw std::system_error(err, std::generic_category(), path);
+        }
+
+        _size = size_t(st.st_size);
+        if (_size != 0)
+        {
+            void* p = ::mmap(nullptr, _size, PROT_READ, MAP_SHARED, fd, 0);
+            if (p == MAP_FAILED)
+            {
+                int err = errno;
+                ::close(fd);
+                throw std::system_error(err, std::generic_category(), path);
+            }
+            _data = p;
+
+            if (access == Access::Sequential)
+                ::madvise(_data, _size, MADV_SEQUENTIAL);
+            else if (access == Access::Random)
+                ::madvise(_data, _size, MADV_RANDOM);
+        }
+
+        // the mapping stays valid after the descriptor is closed
+        ::close(fd);
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile()
+    {
+        if (_data)
+            ::munmap(_data, _size);
+    }
+
+public:
+
+    /// \return address of the mapped content, nullptr for an empty file.
+    const char* data() const { return static_cast<const char*>(_data); }
+
+    /// \return size of the file in bytes.
+    size_t size() const { return _size; }
+
+protected:
+    void* _data;                        ///< Address of the mapping.
+    size_t _size;                       ///< Size of the mapping.
+}; // class MappedFile
+
+
+
+#endif // MAPPED_FILE_HPP_
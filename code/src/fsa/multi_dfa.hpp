@@ -0,0 +1,454 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains declarations of the types for multi-pattern matching.
+/// \author     DFA library contributors
+/// \version    0.1.0
+/// \date       16.10.2026
+/// \copyright  © DFA library contributors 2026.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef MULTI_DFA_HPP_
+#define MULTI_DFA_HPP_
+
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string_view>
+#include <vector>
+
+#include "dfa.hpp"
+#include "nfa.hpp"
+#include "compiled_dfa.hpp"
+
+
+
+/// Identifier of a rule (pattern) of a multi-pattern automaton.
+typedef std::uint32_t RuleId;
+
+
+/*! ****************************************************************************
+ *  \brief CompiledMultiDfa is a compiled DFA whose states carry sets of rules
+ *  they accept, which generalizes the set of accepting states.
+ *
+ *  \tparam Alpha represent elements of the alphabet of an automaton.
+ ******************************************************************************/
+template<typename Alpha>
+class CompiledMultiDfa {
+public:
+    typedef Alpha TAlpha;
+
+    /// Compiled automaton of transitions.
+    typedef CompiledDfa<int, Alpha> SpecCompiledDfa;
+
+    /// Index type of the compiled DFA.
+    typedef typename SpecCompiledDfa::Index Index;
+
+public:
+    // Constructors and all.
+
+    /// Freezes the automaton \a dfa, whose state s accepts the rules
+    /// \a accepts[s]; states must be numbered from 0.
+    CompiledMultiDfa(const Dfa<int, Alpha>& dfa,
+                     const std::vector<std::vector<RuleId>>& accepts)
+        : _dfa(dfa)
+        , _accStart(_dfa.getStatesNum() + 1, 0)
+    {
+        for (Index s = 0; s < _dfa.getStatesNum(); ++s)
+        {
+            size_t q = size_t(_dfa.getState(s));
+            if (q < accepts.size())
+                _accIds.insert(_accIds.end(), accepts[q].begin(), accepts[q].end());
+            _accStart[s + 1] = Index(_accIds.size());
+        }
+    }
+
+public:
+
+    /// \return automaton of transitions.
+    const SpecCompiledDfa& getDfa() const { return _dfa; }
+
+    /// \return true if the state \a s accepts any rule.
+    bool isAccepting(Index s) const { return _accStart[s] != _accStart[s + 1]; }
+
+    /// \return pointer to the first of rules accepted by the state \a s.
+    const RuleId* acceptsBegin(Index s) const { return _accIds.data() + _accStart[s]; }
+
+    /// \return pointer past the last of rules accepted by the state \a s.
+    const RuleId* acceptsEnd(Index s) const { return _accIds.data() + _accStart[s + 1]; }
+
+protected:
+    SpecCompiledDfa _dfa;               ///< Transitions.
+    std::vector<Index> _accStart;       ///< Offsets of rules by states.
+    std::vector<RuleId> _accIds;        ///< Accepted rules.
+}; // class CompiledMultiDfa
+
+
+/*! ****************************************************************************
+ *  \brief MultiDfaBuilder unites automata of several rules into a single
+ *  searching CompiledMultiDfa.
+ *
+ *  As DfaSearcher does, the union is prefixed with `.*`, so every rule is
+ *  searched for at every position of a sequence.
+ *
+ *  \tparam Alpha represent elements of the alphabet of an automaton.
+ ******************************************************************************/
+template<typename Alpha>
+class MultiDfaBuilder {
+public:
+    typedef Alpha TAlpha;
+
+public:
+    // Constructors and all.
+
+    MultiDfaBuilder()
+    {
+        _nfa.setInitState(0);
+        _next = 1;
+    }
+
+public:
+
+    /// Adds the rule \a id given by the automaton \a dfa.
+    template<typename State>
+    void addRule(RuleId id, const Dfa<State, Alpha>& dfa)
+    {
+        if (dfa.getStatesNum() == 0)
+            return;
+
+        Interner<State> states(dfa.getStates().begin(), dfa.getStates().end());
+        const int base = _next;
+        _next += int(states.size());
+
+        _nfa.addEpsTrans(0, base + int(states.find(dfa.getInitState())));
+        for (const auto& t : dfa.getTransTable())
+        {
+            _nfa.addTrans(base + int(states.find(t.first.first)), t.first.second,
+                          base + int(states.find(t.second)));
+        }
+
+        _ruleOf.resize(_next, NoRule);
+        for (State s : dfa.getFinStates())
+        {
+            int q = base + int(states.find(s));
+            _nfa.addFinState(q);
+            _ruleOf[q] = id;
+        }
+    }
+
+    /// Builds the compiled automaton of all the added rules.
+    CompiledMultiDfa<Alpha> build() const
+    {
+        Nfa<int, Alpha> nfa = _nfa;
+        for (Alpha a : nfa.getAlphabet())
+            nfa.addTrans(0, a, 0);
+
+        CompiledNfa<int, Alpha> cnfa(nfa);
+        std::vector<typename CompiledNfa<int, Alpha>::StateSet> subsets;
+        Dfa<int, Alpha> dfa = cnfa.determinize(&subsets);
+
+        std::vector<std::vector<RuleId>> accepts(subsets.size());
+        for (size_t s = 0; s < subsets.size(); ++s)
+        {
+            for (InternId q : subsets[s])
+            {
+                int v = cnfa.getState(q);
+                if (size_t(v) < _ruleOf.size() && _ruleOf[v] != NoRule)
+                    accepts[s].push_back(_ruleOf[v]);
+            }
+            std::sort(accepts[s].begin(), accepts[s].end());
+            accepts[s].erase(std::unique(accepts[s].begin(), accepts[s].end()),
+                             accepts[s].end());
+        }
+
+        return CompiledMultiDfa<Alpha>(dfa, accepts);
+    }
+
+protected:
+    /// Sentinel for NFA states accepting no rule.
+    static constexpr RuleId NoRule = ~RuleId(0);
+
+protected:
+    Nfa<int, Alpha> _nfa;               ///< Union of the rules.
+    int _next;                          ///< Next free NFA state.
+    std::vector<RuleId> _ruleOf;        ///< Rules of NFA states.
+}; // class MultiDfaBuilder
+
+
+/*! ****************************************************************************
+ *  \brief AhoCorasickBuilder builds a CompiledMultiDfa searching for a set
+ *  of literals with the Aho-Corasick construction.
+ *
+ *  Failure links are resolved at build time, so the result is a complete DFA
+ *  over the alphabet of the literals.
+ *
+ *  \tparam Alpha represent elements of the alphabet of an automaton.
+ ******************************************************************************/
+template<typename Alpha>
+class AhoCorasickBuilder {
+public:
+    typedef Alpha TAlpha;
+
+public:
+    // Constructors and all.
+
+    AhoCorasickBuilder()
+        : _trie(1)
+    {
+    }
+
+public:
+
+    /// Adds the literal [\a first, \a last) as the rule \a id.
+    template<typename InputIt>
+    void addLiteral(RuleId id, InputIt first, InputIt last)
+    {
+        int node = 0;
+        for ( ; first != last; ++first)
+        {
+            Alpha a = *first;
+            _alphabet.insert(a);
+
+            auto it = _trie[node].kids.find(a);
+            if (it == _trie[node].kids.end())
+            {
+                it = _trie[node].kids.insert({a, int(_trie.size())}).first;
+                _trie.emplace_back();
+            }
+            node = it->second;
+        }
+        _trie[node].out.push_back(id);
+    }
+
+    /// Adds the literal \a lit as the rule \a id.
+    template<typename Traits>
+    void addLiteral(RuleId id, std::basic_string_view<Alpha, Traits> lit)
+    {
+        addLiteral(id, lit.begin(), lit.end());
+    }
+
+    /// Builds the compiled automaton of all the added literals.
+    CompiledMultiDfa<Alpha> build() const
+    {
+        const int n = int(_trie.size());
+        std::vector<int> fail(n, 0);
+        std::vector<std::vector<RuleId>> out(n);
+        Dfa<int, Alpha> dfa;
+        dfa.setInitState(0);
+        for (Alpha a : _alphabet)
+            dfa.addSymbol(a);
+
+        // breadth-first order guarantees that failure targets are complete
+        std::vector<int> order = {0};
+        std::vector<std::map<Alpha, int>> delta(n);
+        for (size_t i = 0; i < order.size(); ++i)
+        {
+            int node = order[i];
+            out[node] = _trie[node].out;
+            out[node].insert(out[node].end(), out[fail[node]].begin(),
+                             out[fail[node]].end());
+            std::sort(out[node].begin(), out[node].end());
+            out[node].erase(std::unique(out[node].begin(), out[node].end()),
+                            out[node].end());
+
+            for (Alpha a : _alphabet)
+            {
+                auto it = _trie[node].kids.find(a);
+                int d;
+                if (it != _trie[node].kids.end())
+                {
+                    d = it->second;
+                    fail[d] = (node == 0) ? 0 : delta[fail[node]][a];
+                    order.push_back(d);
+                }
+                else
+                    d = (node == 0) ? 0 : delta[fail[node]][a];
+
+                delta[node][a] = d;
+                dfa.addTrans(node, a, d);
+            }
+        }
+
+        return CompiledMultiDfa<Alpha>(dfa, out);
+    }
+
+protected:
+    /// Node of a trie.
+    struct Node {
+        std::map<Alpha, int> kids;      ///< Children by symbols.
+        std::vector<RuleId> out;        ///< Literals ending at the node.
+    };
+
+protected:
+    std::vector<Node> _trie;            ///< Trie of literals, 0 is the root.
+    std::set<Alpha> _alphabet;          ///< Symbols of literals.
+}; // class AhoCorasickBuilder
+
+
+/*! ****************************************************************************
+ *  \brief MultiDfaMatcher reports all (rule, end offset) pairs of matches of
+ *  a CompiledMultiDfa in a sequence in one pass.
+ *
+ *  A symbol out of the alphabet breaks off all the current matches. Matches
+ *  are delivered in the ascending order of offsets (and of rules for the same
+ *  offset) by batches to a sink, a callable `sink(const Match* ms, size_t n)`.
+ *
+ *  \tparam Alpha represent elements of the alphabet of an automaton.
+ ******************************************************************************/
+template<typename Alpha>
+class MultiDfaMatcher {
+public:
+    typedef Alpha TAlpha;
+
+    /// Specified compiled DFA.
+    typedef CompiledMultiDfa<Alpha> SpecCompiledMultiDfa;
+
+    /// Index type of the compiled DFA.
+    typedef typename SpecCompiledMultiDfa::Index Index;
+
+    /// Match of a rule.
+    struct Match {
+        RuleId rule;                    ///< Matched rule.
+        std::uint64_t end;              ///< End offset of the match.
+
+        bool operator==(const Match& m) const
+        {
+            return rule == m.rule && end == m.end;
+        }
+    };
+
+    /// Number of matches delivered to a sink at once (at most).
+    static constexpr size_t BatchSize = 256;
+
+public:
+    // Constructors and all.
+
+    /// Inititalizes a matcher with an automaton.
+    explicit MultiDfaMatcher(const SpecCompiledMultiDfa& dfa)
+        : _dfa(dfa)
+        , _batchLen(0)
+    {
+        begin();
+    }
+
+    /// The automaton is referred to, so it cannot be a temporary.
+    explicit MultiDfaMatcher(const SpecCompiledMultiDfa&& dfa) = delete;
+
+public:
+
+    /// Matches the sequence of \a len symbols at \a seq and delivers all
+    /// the matches to the \a sink.
+    template<typename Sink>
+    void match(const Alpha* seq, size_t len, Sink&& sink)
+    {
+        begin();
+        feed(seq, len, sink);
+        finish(sink);
+    }
+
+    /// Matches the sequence of \a len symbols at \a seq and appends all
+    /// the matches to \a ms.
+    /// \return number of matches found.
+    size_t match(const Alpha* seq, size_t len, std::vector<Match>& ms)
+    {
+        size_t was = ms.size();
+        match(seq, len, [&ms](const Match* m, size_t n)
+                        { ms.insert(ms.end(), m, m + n); });
+
+        return ms.size() - was;
+    }
+
+    // Streaming matching: begin(), feed() any number of chunks, finish().
+
+    /// Starts matching a sequence that is fed by chunks.
+    void begin()
+    {
+        _curState = _dfa.getDfa().getInitIndex();
+        _curPos = 0;
+        _batchLen = 0;
+        _initPending = true;
+    }
+
+    /// Matches the next chunk of \a len symbols at \a chunk; full batches of
+    /// matches are delivered to the \a sink.
+    template<typename Sink>
+    void feed(const Alpha* chunk, size_t len, Sink&& sink)
+    {
+        const typename SpecCompiledMultiDfa::SpecCompiledDfa& dfa = _dfa.getDfa();
+        const Index init = dfa.getInitIndex();
+        reportInit(sink);
+
+        Index s = _curState;
+        for (size_t i = 0; i < len; ++i)
+        {
+            Index c;
+            s = dfa.getSymbolClass(chunk[i], c) ? dfa.getTransIndex(s, c) : init;
+            if (s == SpecCompiledMultiDfa::SpecCompiledDfa::NoTrans)
+                s = init;
+            if (_dfa.isAccepting(s))
+                report(s, _curPos + i + 1, sink);
+        }
+        _curState = s;
+        _curPos += len;
+    }
+
+    /// Finishes matching and delivers the rest of matches to the \a sink.
+    template<typename Sink>
+    void finish(Sink&& sink)
+    {
+        reportInit(sink);
+        if (_batchLen != 0)
+            flush(sink);
+    }
+
+protected:
+    /// Reports matches of the empty word once, at offset 0.
+    template<typename Sink>
+    void reportInit(Sink& sink)
+    {
+        if (_initPending)
+        {
+            _initPending = false;
+            report(_dfa.getDfa().getInitIndex(), 0, sink);
+        }
+    }
+
+    template<typename Sink>
+    void report(Index s, std::uint64_t end, Sink& sink)
+    {
+        for (const RuleId* r = _dfa.acceptsBegin(s); r != _dfa.acceptsEnd(s); ++r)
+        {
+            _batch[_batchLen++] = Match{*r, end};
+            if (_batchLen == BatchSize)
+                flush(sink);
+        }
+    }
+
+    template<typename Sink>
+    void flush(Sink& sink)
+    {
+        sink(static_cast<const Match*>(_batch), _batchLen);
+        _batchLen = 0;
+    }
+
+protected:
+    const SpecCompiledMultiDfa& _dfa;   ///< Ref to the automaton.
+    Index _curState;                    ///< Index of the current state.
+    std::uint64_t _curPos;              ///< Number of matched symbols.
+    bool _initPending;                  ///< Empty matches not reported yet.
+
+    Match _batch[BatchSize];            ///< Matches not delivered yet.
+    size_t _batchLen;                   ///< Number of matches in the batch.
+}; // class MultiDfaMatcher
+
+
+
+#endif // MULTI_DFA_HPP_
@@ -0,0 +1,430 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains declarations of the type for interleaved replays of
+///             several sequences.
+/// \author     DFA library contributors
+/// \version    0.1.0
+/// \date       16.10.2026
+/// \copyright  © DFA library contributors 2026.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef MULTI_STREAM_PLAYER_HPP_
+#define MULTI_STREAM_PLAYER_HPP_
+
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "compiled_dfa.hpp"
+#include "simd.hpp"
+
+
+
+/*! ****************************************************************************
+ *  \brief MultiStreamDfaPlayer replays many independent sequences in
+ *  a compiled automaton, advancing LanesNum of them in lockstep.
+ *
+ *  A single replay waits for every table lookup before it can make the next
+ *  one; lookups of different sequences do not depend on each other, so
+ *  interleaving them keeps many loads in flight at once. Each lane runs
+ *  a sequence and takes the next one as soon as its sequence is over.
+ *
+ *  Lanes make steps in blocks of up to BlockLen symbols, none longer than
+ *  the rest of any sequence, so a step checks no lengths. A block stops
+ *  before the first step missing a transition in any lane, which is then made
+ *  lane by lane. The steps of a block are made by scalar code or, for
+ *  integral symbols of at most two bytes and if asked for, by AVX2 or
+ *  AVX-512 gathers supported by the CPU. Interleaved scalar loads already
+ *  keep as many misses in flight as gathers do and are no slower on small
+ *  tables, while gathers are about a third slower on tables missing caches
+ *  (see play_streams of dfa_bench), so the scalar code is the default.
+ *
+ *  The result, the position, the state and the last symbol of every sequence
+ *  are the same as BasicCompiledDfaPlayer::play() gives; the last symbol of
+ *  an empty sequence is `Alpha()`.
+ *
+ *  \tparam State is a data type for representing states.
+ *  \tparam Alpha represent elements of the alphabet of an automaton.
+ ******************************************************************************/
+template<typename State, typename Alpha>
+class MultiStreamDfaPlayer {
+public:
+    // aliases for State and Alpha
+    typedef State TState;
+    typedef Alpha TAlpha;
+
+    /// Specified compiled DFA.
+    typedef CompiledDfa<State, Alpha> SpecCompiledDfa;
+
+    /// Index type of the compiled DFA.
+    typedef typename SpecCompiledDfa::Index Index;
+
+    /// Results of replaying (shared with DfaPlayer).
+    typedef PlayResult Result;
+
+    /// Sequence to replay.
+    typedef std::basic_string_view<Alpha> Sequence;
+
+    /// Outcome of a replay of a sequence.
+    struct StreamResult {
+        Result result;                  ///< Result of the replay.
+        std::uint64_t pos;              ///< End or broken-off position.
+        Alpha lastSymb;                 ///< Last considered symbol.
+        Index state;                    ///< Index of the last state.
+    }; // struct StreamResult
+
+    /// Number of sequences replayed in lockstep.
+    static constexpr size_t LanesNum = 16;
+
+    /// Maximum number of steps of a block.
+    static constexpr size_t BlockLen = 64;
+
+public:
+    // Constructors and all.
+
+    /// Inititalizes a player with a compiled automaton and an instruction set,
+    /// scalar code by default; unsupported sets are lowered.
+    explicit MultiStreamDfaPlayer(const SpecCompiledDfa& dfa,
+                                  SimdLevel level = SimdLevel::None)
+        : _dfa(dfa)
+        , _level(SimdLevel::None)
+    {
+        // indices of the table must fit the signed indices of gathers
+        bool gathers = SpecCompiledDfa::HasClassTable
+                && dfa.getStatesNum() * dfa.getClassesNum() <= INT_MAX;
+        if (gathers && level >= SimdLevel::Avx512
+                && isSimdSupported(SimdLevel::Avx512))
+            _level = SimdLevel::Avx512;
+        else if (gathers && level >= SimdLevel::Avx2
+                 && isSimdSupported(SimdLevel::Avx2))
+            _level = SimdLevel::Avx2;
+
+        std::fill(_pad, _pad + BlockLen, Alpha());
+    }
+
+    MultiStreamDfaPlayer(const MultiStreamDfaPlayer&) = delete;
+    MultiStreamDfaPlayer& operator=(const MultiStreamDfaPlayer&) = delete;
+
+public:
+
+    /// Plays \a n sequences \a seqs and writes the outcome of the sequence
+    /// `seqs[i]` to `results[i]`.
+    void playStreams(const Sequence* seqs, size_t n, StreamResult* results)
+    {
+        size_t next = 0;
+        size_t activeNum = 0;
+        for (size_t l = 0; l < LanesNum; ++l)
+        {
+            if (fillLane(l, seqs, n, next, results))
+                ++activeNum;
+        }
+
+        while (activeNum != 0)
+        {
+            std::uint64_t steps = BlockLen;
+            for (size_t l = 0; l < LanesNum; ++l)
+            {
+                if (_active[l])
+                    steps = std::min(steps, _left[l]);
+            }
+
+            size_t done = runBlock(size_t(steps));
+            for (size_t l = 0; l < LanesNum; ++l)
+            {
+                if (_active[l])
+                {
+                    _ptrs[l] += done;
+                    _left[l] -= done;
+                    _pos[l] += done;
+                }
+            }
+
+            // some lane misses the next transition
+            if (done < steps)
+            {
+                for (size_t l = 0; l < LanesNum; ++l)
+                {
+                    if (_active[l] && !stepLane(l, results)
+                            && !fillLane(l, seqs, n, next, results))
+                        --activeNum;
+                }
+            }
+
+            for (size_t l = 0; l < LanesNum; ++l)
+            {
+                if (!_active[l] || _left[l] != 0)
+                    continue;
+
+                Index s = _states[l];
+                results[_streams[l]] = StreamResult{
+                        _dfa.isFinIndex(s) ? Result::Ok : Result::NonFinState,
+                        _pos[l], _ptrs[l][-1], s};
+                if (!fillLane(l, seqs, n, next, results))
+                    --activeNum;
+            }
+        }
+    }
+
+    /// Plays the sequences \a seqs, given as string views, strings or vectors.
+    /// \return outcomes of the sequences, in the same order.
+    template<typename Seq>
+    std::vector<StreamResult> playStreams(const std::vector<Seq>& seqs)
+    {
+        std::vector<Sequence> views;
+        views.reserve(seqs.size());
+        for (const Seq& seq : seqs)
+            views.emplace_back(seq.data(), seq.size());
+
+        std::vector<StreamResult> results(seqs.size());
+        playStreams(views.data(), views.size(), results.data());
+
+        return results;
+    }
+
+    /// \return instruction set the steps are made with.
+    SimdLevel getSimdLevel() const { return _level; }
+
+protected:
+    /// Starts the next nonempty sequence in the lane \a l; empty sequences
+    /// are finished at once.
+    /// \return false if there are no sequences left, so the lane is idle.
+    bool fillLane(size_t l, const Sequence* seqs, size_t n, size_t& next,
+                  StreamResult* results)
+    {
+        Index init = _dfa.getInitIndex();
+        for ( ; next < n && seqs[next].empty(); ++next)
+        {
+            results[next] = StreamResult{
+                    _dfa.isFinIndex(init) ? Result::Ok : Result::NonFinState,
+                    0, Alpha(), init};
+        }
+
+        if (next == n)
+        {
+            // an idle lane reads padding and keeps its state
+            _active[l] = 0;
+            _states[l] = 0;
+            _ptrs[l] = _pad;
+            _left[l] = 0;
+            return false;
+        }
+
+        _active[l] = ~Index(0);
+        _states[l] = init;
+        _ptrs[l] = seqs[next].data();
+        _left[l] = seqs[next].size();
+        _pos[l] = 0;
+        _streams[l] = next++;
+        return true;
+    }
+
+    /// Makes a step in the lane \a l.
+    /// \return false if the transition is missing, so the sequence is over.
+    bool stepLane(size_t l, StreamResult* results)
+    {
+        Alpha a = *_ptrs[l];
+        Index c;
+        Index d = SpecCompiledDfa::NoTrans;
+        if (_dfa.getSymbolClass(a, c))
+            d = _dfa.getTransIndex(_states[l], c);
+        if (d == SpecCompiledDfa::NoTrans)
+        {
+            results[_streams[l]] = StreamResult{Result::NoTrans, _pos[l], a,
+                                                _states[l]};
+            return false;
+        }
+
+        _states[l] = d;
+        ++_ptrs[l];
+        --_left[l];
+        ++_pos[l];
+        return true;
+    }
+
+    /// Makes up to \a steps steps in all the active lanes.
+    /// \return number of steps made, less than \a steps if the next one
+    /// misses a transition in some lane.
+    size_t runBlock(size_t steps)
+    {
+#if FSA_X86_SIMD
+        if constexpr (SpecCompiledDfa::HasClassTable)
+        {
+            if (_level == SimdLevel::Avx512)
+                return runAvx512(steps);
+            if (_level == SimdLevel::Avx2)
+                return runAvx2(steps);
+        }
+#endif
+        return runScalar(steps);
+    }
+
+    /// Makes the steps of a block by interleaved scalar lookups.
+    size_t runScalar(size_t steps)
+    {
+        const Index* table = _dfa.getTransTable();
+        const size_t width = _dfa.getClassesNum();
+        Index states[LanesNum];
+        for (size_t k = 0; k < steps; ++k)
+        {
+            bool miss = false;
+            for (size_t l = 0; l < LanesNum; ++l)
+            {
+                states[l] = _states[l];
+                if (!_active[l])
+                    continue;
+
+                Index c;
+                Index d = SpecCompiledDfa::NoTrans;
+                if (_dfa.getSymbolClass(_ptrs[l][k], c))
+                    d = table[_states[l] * width + c];
+                states[l] = d;
+                miss |= (d == SpecCompiledDfa::NoTrans);
+            }
+            if (miss)
+                return k;
+
+            std::copy(states, states + LanesNum, _states);
+        }
+
+        return steps;
+    }
+
+#if FSA_X86_SIMD
+    /// Loads the \a k-th symbols of the lanes as their unsigned values.
+    void loadSymbols(size_t k, std::int32_t* syms) const
+    {
+        for (size_t l = 0; l < LanesNum; ++l)
+            syms[l] = std::int32_t(std::make_unsigned_t<Alpha>(_ptrs[l][k]));
+    }
+
+    /// Makes the steps of a block by AVX2 gathers, two vectors of 8 lanes.
+    __attribute__((target("avx2")))
+    size_t runAvx2(size_t steps)
+    {
+        const int* classes = reinterpret_cast<const int*>(_dfa.getClassTable());
+        const int* table = reinterpret_cast<const int*>(_dfa.getTransTable());
+        const __m256i width = _mm256_set1_epi32(int(_dfa.getClassesNum()));
+        const __m256i none = _mm256_set1_epi32(-1);
+
+        const __m256i* states = reinterpret_cast<const __m256i*>(_states);
+        const __m256i* active = reinterpret_cast<const __m256i*>(_active);
+        __m256i s0 = _mm256_load_si256(states);
+        __m256i s1 = _mm256_load_si256(states + 1);
+        const __m256i act0 = _mm256_load_si256(active);
+        const __m256i act1 = _mm256_load_si256(active + 1);
+
+        alignas(32) std::int32_t syms[LanesNum];
+        size_t k = 0;
+        for ( ; k < steps; ++k)
+        {
+            loadSymbols(k, syms);
+            const __m256i* sv = reinterpret_cast<const __m256i*>(syms);
+
+            // unknown symbols and idle lanes get the class -1
+            __m256i c0 = _mm256_mask_i32gather_epi32(
+                    none, classes, _mm256_load_si256(sv), act0, 4);
+            __m256i c1 = _mm256_mask_i32gather_epi32(
+                    none, classes, _mm256_load_si256(sv + 1), act1, 4);
+            __m256i known0 = _mm256_andnot_si256(
+                    _mm256_cmpeq_epi32(c0, none), act0);
+            __m256i known1 = _mm256_andnot_si256(
+                    _mm256_cmpeq_epi32(c1, none), act1);
+
+            __m256i i0 = _mm256_add_epi32(_mm256_mullo_epi32(s0, width), c0);
+            __m256i i1 = _mm256_add_epi32(_mm256_mullo_epi32(s1, width), c1);
+            __m256i d0 = _mm256_mask_i32gather_epi32(none, table, i0,
+                                                     known0, 4);
+            __m256i d1 = _mm256_mask_i32gather_epi32(none, table, i1,
+                                                     known1, 4);
+
+            __m256i miss = _mm256_or_si256(
+                    _mm256_and_si256(_mm256_cmpeq_epi32(d0, none), act0),
+                    _mm256_and_si256(_mm256_cmpeq_epi32(d1, none), act1));
+            if (!_mm256_testz_si256(miss, miss))
+                break;
+
+            s0 = _mm256_blendv_epi8(s0, d0, act0);
+            s1 = _mm256_blendv_epi8(s1, d1, act1);
+        }
+
+        __m256i* out = reinterpret_cast<__m256i*>(_states);
+        _mm256_store_si256(out, s0);
+        _mm256_store_si256(out + 1, s1);
+
+        return k;
+    }
+
+    /// Makes the steps of a block by AVX-512 gathers of all the lanes.
+    __attribute__((target("avx512f")))
+    size_t runAvx512(size_t steps)
+    {
+        const void* classes = _dfa.getClassTable();
+        const void* table = _dfa.getTransTable();
+        const __m512i width = _mm512_set1_epi32(int(_dfa.getClassesNum()));
+        const __m512i none = _mm512_set1_epi32(-1);
+
+        __m512i s = _mm512_load_si512(_states);
+        const __mmask16 act = _mm512_test_epi32_mask(
+                _mm512_load_si512(_active), _mm512_load_si512(_active));
+
+        alignas(64) std::int32_t syms[LanesNum];
+        size_t k = 0;
+        for ( ; k < steps; ++k)
+        {
+            loadSymbols(k, syms);
+
+            // unknown symbols and idle lanes get the class -1
+            __m512i c = _mm512_mask_i32gather_epi32(
+                    none, act, _mm512_load_si512(syms), classes, 4);
+            __mmask16 known = _mm512_mask_cmpneq_epi32_mask(act, c, none);
+
+            __m512i i = _mm512_add_epi32(_mm512_mullo_epi32(s, width), c);
+            __m512i d = _mm512_mask_i32gather_epi32(none, known, i, table, 4);
+            if (_mm512_mask_cmpeq_epi32_mask(act, d, none) != 0)
+                break;
+
+            s = _mm512_mask_mov_epi32(s, act, d);
+        }
+        _mm512_store_si512(_states, s);
+
+        return k;
+    }
+#endif
+
+protected:
+    const SpecCompiledDfa& _dfa;        ///< Ref to the automaton.
+    SimdLevel _level;                   ///< Instruction set of steps.
+
+    // lanes; the first two are read by vector loads
+
+    alignas(64) Index _states[LanesNum];    ///< Current states.
+    alignas(64) Index _active[LanesNum];    ///< All ones if a lane is busy.
+    const Alpha* _ptrs[LanesNum];       ///< Next symbols.
+    std::uint64_t _left[LanesNum];      ///< Numbers of symbols left.
+    std::uint64_t _pos[LanesNum];       ///< Current positions.
+    size_t _streams[LanesNum];          ///< Replayed sequences.
+
+    Alpha _pad[BlockLen];               ///< Symbols of idle lanes.
+}; // class MultiStreamDfaPlayer
+
+
+template<typename State, typename Alpha>
+constexpr size_t MultiStreamDfaPlayer<State, Alpha>::LanesNum;
+
+template<typename State, typename Alpha>
+constexpr size_t MultiStreamDfaPlayer<State, Alpha>::BlockLen;
+
+
+
+#endif // MULTI_STREAM_PLAYER_HPP_
@@ -0,0 +1,500 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains declarations of the types for NFAs.
+/// \author     DFA library contributors
+/// \version    0.1.0
+/// \date       16.10.2026
+/// \copyright  © DFA library contributors 2026.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef NFA_HPP_
+#define NFA_HPP_
+
+
+#include <set>
+#include <map>
+#include <vector>
+#include <tuple>
+#include <algorithm>
+#include <unordered_map>
+
+#include "dfa.hpp"
+#include "interner.hpp"
+
+
+
+/*! ****************************************************************************
+ *  \brief Nfa represents a parametrized nondeterministic finite state automaton
+ *  with epsilon transitions.
+ *
+ *  \tparam State is a data type for representing states. Must be compact enough
+ *  to maintain multiple copy-by-value operations.
+ *  \tparam Alpha represent elements of the alphabet of an automaton. Must be
+ *  compact enough to maintain multiple copy-by-value operations.
+ ******************************************************************************/
+template<typename State, typename Alpha>
+class Nfa {
+public:
+    // aliases for State and Alpha
+    typedef State TState;
+    typedef Alpha TAlpha;
+
+    /// Define a set of states type.
+    typedef std::set<State> States;
+
+    /// Define a set of alphabet symbols type.
+    typedef std::set<Alpha> Alphabet;
+
+    /// State-State pair.
+    typedef std::pair<State, State> StateStatePair;
+
+    /// State-Alpha-State tuple.
+    typedef std::tuple<State, Alpha, State> StateAlphaState;
+
+    /// Transition relation delta.
+    typedef std::set<StateAlphaState> TransRel;
+
+    /// Epsilon transition relation.
+    typedef std::set<StateStatePair> EpsTransRel;
+
+    /// Deterministic automaton produced by the subset construction.
+    typedef Dfa<int, Alpha> SpecDfa;
+
+public:
+
+    // Constructors and all.
+
+    ///  Default constructor.
+    Nfa() = default;
+
+    /// Inititalizes an automaton with an init state \a init, a set of
+    /// transitions \a l, a set of epsilon transitions \a eps and a set of
+    /// accepting states \a fin.
+    Nfa(State init, std::initializer_list<StateAlphaState> l,
+        std::initializer_list<StateStatePair> eps,
+        std::initializer_list<State> fin)
+    {
+        for (const StateAlphaState& t : l)
+            addTrans(std::get<0>(t), std::get<1>(t), std::get<2>(t));
+
+        for (const StateStatePair& t : eps)
+            addEpsTrans(t.first, t.second);
+
+        // init state
+        setInitState(init);
+
+        // accepting states
+        for (State s : fin)
+            addFinState(s);
+    }
+
+public:
+    // Modifying the structure of an automaton.
+
+    /// Adds a new state \a s.
+    /// \returns the newly added state.
+    State addState(State s)
+    {
+        // for the very first added state set it as the initial (can be changed)
+        if (_states.size() == 0)
+            _init = s;
+
+        _states.insert(s);
+
+        return s;
+    }
+
+    /// Adds a new symbol \a a.
+    /// \returns the newly added symbol.
+    Alpha addSymbol(Alpha a)
+    {
+        _alphabet.insert(a);
+
+        return a;
+    }
+
+    /// Adds a new transition from the state \a s to the state \a d labeled with
+    /// the symbol \a a.
+    void addTrans(State s, Alpha a, State d)
+    {
+        addState(s);
+        addState(d);
+        addSymbol(a);
+
+        _transRel.insert(StateAlphaState(s, a, d));
+    }
+
+    /// Adds a new epsilon transition from the state \a s to the state \a d.
+    void addEpsTrans(State s, State d)
+    {
+        addState(s);
+        addState(d);
+
+        _epsRel.insert({s, d});
+    }
+
+    /// Adds a new accepting state \a s.
+    /// \returns the newly added state.
+    State addFinState(State s)
+    {
+        addState(s);
+        _finStates.insert(s);
+
+        return s;
+    }
+
+    /// Sets a new initial state.
+    State setInitState(State init)
+    {
+        addState(init);
+        _init = init;
+
+        return init;
+    }
+
+    // Setters/getters
+
+    /// \return init state.
+    State getInitState() const { return _init; }
+
+    /// \return number of states in an automaton.
+    size_t getStatesNum() const { return _states.size(); }
+
+    /// \return number of symbols in an automaton.
+    size_t getSymbolsNum() const { return _alphabet.size(); }
+
+    /// \return number of symbol-labeled transitions in an automaton.
+    size_t getTransNum() const { return _transRel.size(); }
+
+    /// \return number of epsilon transitions in an automaton.
+    size_t getEpsTransNum() const { return _epsRel.size(); }
+
+    /// \return number of accepting states in an automaton.
+    size_t getFinStatesNum() const { return _finStates.size(); }
+
+    /// \return set of states.
+    const States& getStates() const { return _states; }
+
+    /// \return alphabet.
+    const Alphabet& getAlphabet() const { return _alphabet; }
+
+    /// \return transition relation.
+    const TransRel& getTransRel() const { return _transRel; }
+
+    /// \return epsilon transition relation.
+    const EpsTransRel& getEpsTransRel() const { return _epsRel; }
+
+    /// \return set of accepting states.
+    const States& getFinStates() const { return _finStates; }
+
+    /// Checks whether the state \a s belongs to the set of accepting states.
+    bool hasFinState(State s) const
+    {
+        return (_finStates.find(s) != _finStates.end());
+    }
+
+public:
+    // Operations on automata.
+
+    /// \return the set of states reachable from the states \a ss by epsilon
+    /// transitions only, \a ss included.
+    States getEpsClosure(const States& ss) const;
+
+    /// Builds an equivalent DFA by the subset construction. States of the DFA
+    /// are numbered from 0 (the init one) in the order of their discovery.
+    SpecDfa determinize() const;
+
+protected:
+    States _states;             ///< Set of states (Q).
+    State _init;                ///< Initial state (q0).
+    Alphabet _alphabet;         ///< Alphabet (\Sigma).
+    TransRel _transRel;         ///< Transition relation (\delta).
+    EpsTransRel _epsRel;        ///< Epsilon transitions.
+    States _finStates;          ///< Set of accepting states (F).
+}; // class Nfa
+
+
+/*! ****************************************************************************
+ *  \brief CompiledNfa is a frozen form of an Nfa with dense state and symbol
+ *  indices, used by the subset construction.
+ *
+ *  Sets of states are represented by sorted vectors of indices.
+ ******************************************************************************/
+template<typename State, typename Alpha>
+class CompiledNfa {
+public:
+    /// Specified NFA.
+    typedef Nfa<State, Alpha> SpecNfa;
+
+    /// Dense index of a state or a symbol.
+    typedef InternId Index;
+
+    /// Set of states as a sorted vector of indices.
+    typedef std::vector<Index> StateSet;
+
+    /// Hash of a state set.
+    struct StateSetHash {
+        size_t operator()(const StateSet& ss) const
+        {
+            size_t h = ss.size();
+            for (Index q : ss)
+                h = (h ^ q) * 0x100000001b3ull;
+            return h;
+        }
+    };
+
+public:
+    // Constructors and all.
+
+    /// Freezes the automaton \a nfa.
+    explicit CompiledNfa(const SpecNfa& nfa)
+        : _states(nfa.getStates().begin(), nfa.getStates().end())
+        , _symbols(nfa.getAlphabet().begin(), nfa.getAlphabet().end())
+        , _outStart(_states.size() + 1, 0)
+        , _epsStart(_states.size() + 1, 0)
+        , _fin(_states.size(), 0)
+        , _stamp(_states.size(), 0)
+        , _gen(0)
+    {
+        // both relations are ordered by source states, so are the indices
+        for (const auto& t : nfa.getTransRel())
+        {
+            ++_outStart[_states.find(std::get<0>(t)) + 1];
+            _outSym.push_back(_symbols.find(std::get<1>(t)));
+            _outDst.push_back(_states.find(std::get<2>(t)));
+        }
+        for (const auto& t : nfa.getEpsTransRel())
+        {
+            ++_epsStart[_states.find(t.first) + 1];
+            _epsDst.push_back(_states.find(t.second));
+        }
+        for (size_t q = 0; q < _states.size(); ++q)
+        {
+            _outStart[q + 1] += _outStart[q];
+            _epsStart[q + 1] += _epsStart[q];
+        }
+
+        for (State s : nfa.getFinStates())
+            _fin[_states.find(s)] = 1;
+
+        _init = (_states.size() != 0) ? _states.find(nfa.getInitState())
+                                      : NoInternId;
+    }
+
+public:
+
+    /// \return number of states.
+    size_t getStatesNum() const { return _states.size(); }
+
+    /// \return number of symbols.
+    size_t getSymbolsNum() const { return _symbols.size(); }
+
+    /// \return state with the index \a i.
+    const State& getState(Index i) const { return _states.value(i); }
+
+    /// \return symbol with the index \a i.
+    const Alpha& getSymbol(Index i) const { return _symbols.value(i); }
+
+    /// \return index of the symbol \a a, or NoInternId if there is no such one.
+    Index findSymbol(const Alpha& a) const { return _symbols.find(a); }
+
+    /// \return index of the state \a s, or NoInternId if there is no such one.
+    Index findState(const State& s) const { return _states.find(s); }
+
+    /// \return true if the state with the index \a q is accepting.
+    bool isFinIndex(Index q) const { return _fin[q] != 0; }
+
+    /// \return true if the set \a ss contains an accepting state.
+    bool hasFinIndex(const StateSet& ss) const
+    {
+        for (Index q : ss)
+        {
+            if (_fin[q])
+                return true;
+        }
+        return false;
+    }
+
+    /// \return epsilon closure of the init state.
+    StateSet getInitClosure()
+    {
+        StateSet ss;
+        if (_init != NoInternId)
+            ss.push_back(_init);
+        closure(ss);
+        return ss;
+    }
+
+    /// Extends the set \a ss to its epsilon closure; the result is sorted.
+    void closure(StateSet& ss)
+    {
+        nextGen();
+        for (Index q : ss)
+            _stamp[q] = _gen;
+
+        for (size_t i = 0; i < ss.size(); ++i)
+        {
+            Index q = ss[i];
+            for (Index j = _epsStart[q]; j < _epsStart[q + 1]; ++j)
+            {
+                Index d = _epsDst[j];
+                if (_stamp[d] != _gen)
+                {
+                    _stamp[d] = _gen;
+                    ss.push_back(d);
+                }
+            }
+        }
+        std::sort(ss.begin(), ss.end());
+    }
+
+    /// Computes the closed set of states reachable from the set \a ss by the
+    /// symbol with the index \a c and stores it in \a res.
+    void move(const StateSet& ss, Index c, StateSet& res)
+    {
+        res.clear();
+        nextGen();
+        for (Index q : ss)
+        {
+            auto from = _outSym.begin() + _outStart[q];
+            auto to = _outSym.begin() + _outStart[q + 1];
+            for (auto it = std::lower_bound(from, to, c);
+                 it != to && *it == c; ++it)
+            {
+                Index d = _outDst[it - _outSym.begin()];
+                if (_stamp[d] != _gen)
+                {
+                    _stamp[d] = _gen;
+                    res.push_back(d);
+                }
+            }
+        }
+        closure(res);
+    }
+
+    /// Computes all (symbol, destination) pairs of transitions leaving
+    /// the set \a ss grouped by symbols.
+    void moves(const StateSet& ss, std::vector<std::pair<Index, Index>>& res) const
+    {
+        res.clear();
+        for (Index q : ss)
+        {
+            for (Index j = _outStart[q]; j < _outStart[q + 1]; ++j)
+                res.push_back({_outSym[j], _outDst[j]});
+        }
+        std::sort(res.begin(), res.end());
+        res.erase(std::unique(res.begin(), res.end()), res.end());
+    }
+
+    /// Builds an equivalent DFA by the subset construction. If \a subsets is
+    /// given, it is filled with the set of NFA states of every DFA state.
+    Dfa<int, Alpha> determinize(std::vector<StateSet>* subsets = nullptr)
+    {
+        Dfa<int, Alpha> res;
+        for (Index c = 0; c < _symbols.size(); ++c)
+            res.addSymbol(_symbols.value(c));
+
+        std::unordered_map<StateSet, int, StateSetHash> ids;
+        std::vector<StateSet> sets;
+        sets.push_back(getInitClosure());
+        ids.insert({sets[0], 0});
+        res.setInitState(0);
+
+        std::vector<std::pair<Index, Index>> mv;
+        StateSet next;
+        for (size_t cur = 0; cur < sets.size(); ++cur)
+        {
+            if (hasFinIndex(sets[cur]))
+                res.addFinState(int(cur));
+
+            moves(sets[cur], mv);
+            for (size_t i = 0; i < mv.size(); )
+            {
+                Index c = mv[i].first;
+                next.clear();
+                for ( ; i < mv.size() && mv[i].first == c; ++i)
+                    next.push_back(mv[i].second);
+                closure(next);
+
+                auto it = ids.find(next);
+                if (it == ids.end())
+                {
+                    it = ids.insert({next, int(sets.size())}).first;
+                    sets.push_back(next);
+                }
+                res.addTrans(int(cur), _symbols.value(c), it->second);
+            }
+        }
+
+        if (subsets)
+            subsets->swap(sets);
+
+        return res;
+    }
+
+protected:
+    /// Starts a new generation of visit marks.
+    void nextGen()
+    {
+        if (++_gen == 0)
+        {
+            std::fill(_stamp.begin(), _stamp.end(), 0);
+            _gen = 1;
+        }
+    }
+
+protected:
+    Interner<State> _states;            ///< Interned states.
+    Interner<Alpha> _symbols;           ///< Interned symbols.
+    std::vector<Index> _outStart;       ///< Offsets of transitions by states.
+    std::vector<Index> _outSym;         ///< Symbols of transitions.
+    std::vector<Index> _outDst;         ///< Destinations of transitions.
+    std::vector<Index> _epsStart;       ///< Offsets of eps-transitions.
+    std::vector<Index> _epsDst;         ///< Destinations of eps-transitions.
+    std::vector<char> _fin;             ///< Accepting flags per state.
+    Index _init;                        ///< Index of the init state.
+
+    std::vector<unsigned> _stamp;       ///< Visit marks per state.
+    unsigned _gen;                      ///< Current generation of marks.
+}; // class CompiledNfa
+
+
+template<typename State, typename Alpha>
+typename Nfa<State, Alpha>::States
+Nfa<State, Alpha>::getEpsClosure(const States& ss) const
+{
+    CompiledNfa<State, Alpha> cnfa(*this);
+
+    typename CompiledNfa<State, Alpha>::StateSet set;
+    for (State s : ss)
+    {
+        InternId q = cnfa.findState(s);
+        if (q != NoInternId)
+            set.push_back(q);
+    }
+    cnfa.closure(set);
+
+    States res;
+    for (InternId q : set)
+        res.insert(cnfa.getState(q));
+    return res;
+}
+
+template<typename State, typename Alpha>
+typename Nfa<State, Alpha>::SpecDfa Nfa<State, Alpha>::determinize() const
+{
+    CompiledNfa<State, Alpha> cnfa(*this);
+
+    return cnfa.determinize();
+}
+
+
+
+#endif // NFA_HPP_
@@ -0,0 +1,327 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains declarations of the type for parallel replays of
+///             a single sequence.
+/// \author     DFA library contributors
+/// \version    0.1.0
+/// \date       16.10.2026
+/// \copyright  © DFA library contributors 2026.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef PARALLEL_PLAYER_HPP_
+#define PARALLEL_PLAYER_HPP_
+
+
+#include <algorithm>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "shared_dfa.hpp"
+#include "thread_pool.hpp"
+
+
+
+/*! ****************************************************************************
+ *  \brief ParallelDfaPlayer replays a single long sequence in a shared
+ *  compiled automaton on the threads of a WorkStealingPool.
+ *
+ *  The sequence is split into chunks. The first chunk is replayed from
+ *  the init state; every other chunk is replayed from all the states at once,
+ *  which gives the transition function of the chunk: the state it ends in or
+ *  the position it breaks off at, for every start state. Replays from
+ *  different start states reaching the same state are merged, so for most
+ *  automata only a few of them remain after a short prefix of a chunk.
+ *  The functions are then applied one after another to the init state, which
+ *  takes a step per chunk.
+ *
+ *  The result, the position, the state and the last symbol are the same as
+ *  BasicCompiledDfaPlayer::play() gives. A chunk costs up to as many times
+ *  more than a sequential replay as there are states, so automata with more
+ *  than getMaxStatesNum() states, short sequences and pools of a single
+ *  thread are replayed sequentially.
+ *
+ *  A player must not be used by several threads at once.
+ *
+ *  \tparam State is a data type for representing states.
+ *  \tparam Alpha represent elements of the alphabet of an automaton.
+ ******************************************************************************/
+template<typename State, typename Alpha>
+class ParallelDfaPlayer {
+public:
+    // aliases for State and Alpha
+    typedef State TState;
+    typedef Alpha TAlpha;
+
+    /// Handle of the automaton.
+    typedef SharedDfa<State, Alpha> SpecSharedDfa;
+
+    /// Specified compiled DFA.
+    typedef CompiledDfa<State, Alpha> SpecCompiledDfa;
+
+    /// Index type of the compiled DFA.
+    typedef typename SpecCompiledDfa::Index Index;
+
+    /// Results of replaying (shared with DfaPlayer).
+    typedef PlayResult Result;
+
+    /// Default maximum number of states of an automaton replayed in parallel.
+    static constexpr size_t DefMaxStatesNum = 64;
+
+    /// Minimum length of a chunk.
+    static constexpr size_t MinChunkLen = 1 << 16;
+
+    /// Number of chunks per thread, for balancing.
+    static constexpr size_t ChunksPerThread = 4;
+
+    /// Number of symbols between merges of replays of a chunk.
+    static constexpr size_t MergePeriod = 64;
+
+public:
+    // Constructors and all.
+
+    /// Inititalizes a player with a shared automaton, a pool and a maximum
+    /// number of states to be replayed in parallel.
+    ParallelDfaPlayer(const SpecSharedDfa& dfa, WorkStealingPool& pool,
+                      size_t maxStatesNum = DefMaxStatesNum)
+        : _dfa(dfa)
+        , _pool(pool)
+        , _maxStatesNum(maxStatesNum)
+        , _curState(dfa->getInitIndex())
+        , _curPos(0)
+        , _lastSymb(Alpha())
+    {
+    }
+
+public:
+
+    /// Plays a sequence of \a len symbols stored at \a seq.
+    /// \return the same result as BasicCompiledDfaPlayer::play() does.
+    Result play(const Alpha* seq, size_t len)
+    {
+        if (!isSplit(len))
+            return playSeq(seq, len);
+
+        const SpecCompiledDfa& dfa = *_dfa;
+        const size_t statesNum = dfa.getStatesNum();
+        const size_t chunksNum = getChunksNum(len);
+        const Index init = dfa.getInitIndex();
+
+        // chunk i is replayed from every start state to the outcomes
+        // [i * statesNum, (i + 1) * statesNum); the first one from init only
+        _outcomes.resize(chunksNum * statesNum);
+        _pool.parallelFor(chunksNum, [&](size_t i)
+        {
+            size_t first = len * i / chunksNum;
+            size_t last = len * (i + 1) / chunksNum;
+            replayChunk(seq, first, last, (i == 0) ? &init : nullptr,
+                        (i == 0) ? 1 : statesNum,
+                        _outcomes.data() + i * statesNum);
+        });
+
+        // composition of the chunk functions applied to init
+        Outcome out = _outcomes[init];
+        for (size_t i = 1; i < chunksNum && !out.noTrans; ++i)
+            out = _outcomes[i * statesNum + out.state];
+
+        _curState = out.state;
+        _curPos = out.pos;
+        _lastSymb = out.symb;
+        if (out.noTrans)
+            return Result::NoTrans;
+
+        return dfa.isFinIndex(_curState) ? Result::Ok : Result::NonFinState;
+    }
+
+    /// Plays a sequence provided as a string view.
+    template<typename Traits>
+    Result play(std::basic_string_view<Alpha, Traits> seq)
+    {
+        return play(seq.data(), seq.size());
+    }
+
+    /// Plays a sequence provided as a vector.
+    Result play(const std::vector<Alpha>& seq)
+    {
+        return play(seq.data(), seq.size());
+    }
+
+    /// \return true if a sequence of \a len symbols is replayed in parallel.
+    bool isSplit(size_t len) const
+    {
+        size_t statesNum = _dfa->getStatesNum();
+        return _pool.getThreadsNum() > 1 && statesNum != 0
+               && statesNum <= _maxStatesNum && len >= 2 * MinChunkLen;
+    }
+
+    /// \return maximum number of states of an automaton replayed in parallel.
+    size_t getMaxStatesNum() const { return _maxStatesNum; }
+
+    /// Returns state being visited.
+    State getCurState() const { return _dfa->getState(_curState); }
+
+    /// Returns index of the state being visited.
+    Index getCurIndex() const { return _curState; }
+
+    /// Returns current position in the replayed sequence.
+    std::uint64_t getCurPos() const { return _curPos; }
+
+    /// Returns the last considered symbol.
+    Alpha getLastSymbol() const { return _lastSymb; }
+
+protected:
+    /// Outcome of a replay of a chunk from a start state.
+    struct Outcome {
+        Index state;                    ///< End state or the one broken at.
+        std::uint64_t pos;              ///< End or broken-off position.
+        Alpha symb;                     ///< Last considered symbol.
+        bool noTrans;                   ///< Replay has broken off.
+    }; // struct Outcome
+
+protected:
+    /// \return number of chunks a sequence of \a len symbols is split into.
+    size_t getChunksNum(size_t len) const
+    {
+        size_t n = _pool.getThreadsNum() * ChunksPerThread;
+        return std::max<size_t>(1, std::min(n, len / MinChunkLen));
+    }
+
+    /// Replays the sequence in the calling thread.
+    Result playSeq(const Alpha* seq, size_t len)
+    {
+        BasicCompiledDfaPlayer<State, Alpha, NullListener> player(*_dfa);
+        Result res = player.play(seq, len);
+        _curState = player.getCurIndex();
+        _curPos = player.getCurPos();
+        _lastSymb = player.getLastSymbol();
+
+        return res;
+    }
+
+    /// Replays the chunk [\a first, \a last) of \a seq from \a startsNum
+    /// states: \a starts or, if null, the states 0, 1, ... and writes
+    /// the outcome of the start state s to `outs[s]`.
+    void replayChunk(const Alpha* seq, size_t first, size_t last,
+                     const Index* starts, size_t startsNum, Outcome* outs) const
+    {
+        const SpecCompiledDfa& dfa = *_dfa;
+
+        // replay j runs from the j-th start state; merged replays refer to
+        // the one they go on as
+        std::vector<Index> states(startsNum);
+        std::vector<Index> mergedTo(startsNum);
+        std::vector<Outcome> replayOuts(startsNum);
+        std::vector<Index> active(startsNum);
+        for (size_t j = 0; j < startsNum; ++j)
+        {
+            states[j] = starts ? starts[j] : Index(j);
+            mergedTo[j] = Index(j);
+            active[j] = Index(j);
+        }
+
+        // replay running in a state, plus one; zero if none
+        std::vector<Index> inState(dfa.getStatesNum(), 0);
+
+        size_t activeNum = startsNum;
+        for (size_t pos = first; pos < last && activeNum != 0; ++pos)
+        {
+            Alpha a = seq[pos];
+            Index c;
+            bool known = dfa.getSymbolClass(a, c);
+
+            size_t kept = 0;
+            for (size_t k = 0; k < activeNum; ++k)
+            {
+                Index j = active[k];
+                Index d = known ? dfa.getTransIndex(states[j], c)
+                                : SpecCompiledDfa::NoTrans;
+                if (d == SpecCompiledDfa::NoTrans)
+                {
+                    replayOuts[j] = Outcome{states[j], pos, a, true};
+                    continue;
+                }
+                states[j] = d;
+                active[kept++] = j;
+            }
+            activeNum = kept;
+
+            if ((pos - first) % MergePeriod == MergePeriod - 1)
+                activeNum = merge(states, mergedTo, active, activeNum, inState);
+        }
+
+        for (size_t k = 0; k < activeNum; ++k)
+        {
+            Index j = active[k];
+            replayOuts[j] = Outcome{states[j], last, seq[last - 1], false};
+        }
+
+        for (size_t j = 0; j < startsNum; ++j)
+        {
+            Index r = Index(j);
+            while (mergedTo[r] != r)
+                r = mergedTo[r];
+            outs[starts ? starts[j] : j] = replayOuts[r];
+        }
+    }
+
+    /// Merges the active replays being in the same state into one.
+    /// \return number of active replays left.
+    static size_t merge(const std::vector<Index>& states,
+                        std::vector<Index>& mergedTo,
+                        std::vector<Index>& active, size_t activeNum,
+                        std::vector<Index>& inState)
+    {
+        size_t kept = 0;
+        for (size_t k = 0; k < activeNum; ++k)
+        {
+            Index j = active[k];
+            Index& r = inState[states[j]];
+            if (r != 0)
+            {
+                mergedTo[j] = r - 1;
+                continue;
+            }
+            r = j + 1;
+            active[kept++] = j;
+        }
+
+        for (size_t k = 0; k < kept; ++k)
+            inState[states[active[k]]] = 0;
+
+        return kept;
+    }
+
+protected:
+    SpecSharedDfa _dfa;                 ///< Handle of the automaton.
+    WorkStealingPool& _pool;            ///< Pool of threads.
+    size_t _maxStatesNum;               ///< Limit of states to split.
+    std::vector<Outcome> _outcomes;     ///< Chunk functions, reused.
+
+    Index _curState;                    ///< Index of the current state.
+    std::uint64_t _curPos;              ///< Currently replayed symbol.
+    Alpha _lastSymb;                    ///< Stores last replayed symbol.
+}; // class ParallelDfaPlayer
+
+
+template<typename State, typename Alpha>
+constexpr size_t ParallelDfaPlayer<State, Alpha>::DefMaxStatesNum;
+
+template<typename State, typename Alpha>
+constexpr size_t ParallelDfaPlayer<State, Alpha>::MinChunkLen;
+
+template<typename State, typename Alpha>
+constexpr size_t ParallelDfaPlayer<State, Alpha>::ChunksPerThread;
+
+template<typename State, typename Alpha>
+constexpr size_t ParallelDfaPlayer<State, Alpha>::MergePeriod;
+
+
+
+#endif // PARALLEL_PLAYER_HPP_
@@ -0,0 +1,564 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains declarations of the regular expression compiler.
+/// \author     DFA library contributors
+/// \version    0.1.0
+/// \date       16.10.2026
+/// \copyright  © DFA library contributors 2026.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef REGEX_HPP_
+#define REGEX_HPP_
+
+
+#include <algorithm>
+#include <bitset>
+#include <cctype>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "dfa.hpp"
+#include "nfa.hpp"
+
+
+
+/*! ****************************************************************************
+ *  \brief Exception thrown on a malformed regular expression.
+ ******************************************************************************/
+class RegexError : public std::runtime_error {
+public:
+    /// Makes an error with a message \a what found at the position \a pos.
+    RegexError(const std::string& what, size_t pos)
+        : std::runtime_error(what + " at position " + std::to_string(pos))
+        , _pos(pos)
+    {
+    }
+
+    /// \return position in the pattern where the error is found.
+    size_t getPos() const { return _pos; }
+
+protected:
+    size_t _pos;                        ///< Position of the error.
+}; // class RegexError
+
+
+/*! ****************************************************************************
+ *  \brief RegexCompiler translates regular expressions over bytes into
+ *  automata.
+ *
+ *  The following syntax is supported:
+ *  - `ab` concatenation, `a|b` alternation, `(a)` grouping;
+ *  - `a*`, `a+`, `a?` repetitions and bounded ones `a{m}`, `a{m,}`, `a{m,n}`;
+ *  - `[abc]`, `[a-z]`, `[^0-9]` character classes, `.` for any byte but `\n`;
+ *  - escapes `\d \D \w \W \s \S \n \r \t \xHH` and `\` before
+ *    a metacharacter.
+ *
+ *  A pattern is matched against a whole sequence (the match is anchored at
+ *  both ends).
+ *
+ *  Nested repetitions multiply the copies of their operands, so the NFA is
+ *  limited to a budget of states, and the syntax tree to MaxDepth levels
+ *  for the recursive parser and emitter not to overflow the stack; both
+ *  are checked while parsing, before anything is emitted.
+ ******************************************************************************/
+class RegexCompiler {
+public:
+    typedef Nfa<int, char> IntCharNfa;
+    typedef Dfa<int, char> IntCharDfa;
+
+    /// Upper bound of a number in a bounded repetition.
+    static constexpr unsigned MaxRepeat = 1000;
+
+    /// Unbounded number of repetitions.
+    static constexpr unsigned Inf = ~0u;
+
+    /// Default budget of states of an NFA.
+    static constexpr size_t DefMaxStates = size_t(1) << 20;
+
+    /// Maximum depth of a syntax tree.
+    static constexpr unsigned MaxDepth = 1000;
+
+public:
+
+    /// Compiles the pattern \a re to a Thompson NFA of at most \a maxStates
+    /// states.
+    /// \throws RegexError if the pattern is malformed or too large.
+    static IntCharNfa compileNfa(const std::string& re,
+                                 size_t maxStates = DefMaxStates)
+    {
+        RegexCompiler rc(re, maxStates);
+        std::unique_ptr<Node> root = rc.parseAlt();
+        if (rc._pos != re.size())
+            throw RegexError("unmatched ')'", rc._pos);
+
+        IntCharNfa nfa;
+        int next = 0;
+        Frag f = emit(*root, nfa, next);
+        nfa.setInitState(f.first);
+        nfa.addFinState(f.second);
+
+        return nfa;
+    }
+
+    /// Compiles the pattern \a re to a DFA, which is minimized unless
+    /// \a minimize is false, through an NFA of at most \a maxStates states.
+    /// \throws RegexError if the pattern is malformed or too large.
+    static IntCharDfa compile(const std::string& re, bool minimize = true,
+                              size_t maxStates = DefMaxStates)
+    {
+        IntCharDfa dfa = compileNfa(re, maxStates).determinize();
+
+        return minimize ? dfa.minimize() : dfa;
+    }
+
+protected:
+    /// Set of bytes.
+    typedef std::bitset<256> ByteSet;
+
+    /// Types of nodes of a syntax tree.
+    enum class NodeType {
+        Empty,              ///< Empty word.
+        Bytes,              ///< A byte of a set.
+        Concat,             ///< Concatenation of children.
+        Alt,                ///< Alternation of children.
+        Repeat,             ///< Repetition of the only child.
+    };
+
+    /// Node of a syntax tree.
+    struct Node {
+        NodeType type;
+        ByteSet bytes;                              ///< For Bytes.
+        unsigned min = 0;                           ///< For Repeat.
+        unsigned max = 0;                           ///< For Repeat.
+        std::vector<std::unique_ptr<Node>> kids;
+        size_t statesNum = 2;                       ///< States to emit.
+        unsigned depth = 1;                         ///< Depth of the subtree.
+
+        explicit Node(NodeType t) : type(t) {}
+    };
+
+    /// Fragment of an NFA given by its entry and exit states.
+    typedef std::pair<int, int> Frag;
+
+protected:
+    RegexCompiler(const std::string& re, size_t maxStates)
+        : _re(re)
+        , _pos(0)
+        , _maxStates(maxStates)
+        , _nesting(0)
+    {
+    }
+
+    bool atEnd() const { return _pos == _re.size(); }
+
+    char peek() const { return _re[_pos]; }
+
+    /// alt := concat ('|' concat)*
+    std::unique_ptr<Node> parseAlt()
+    {
+        std::unique_ptr<Node> node(new Node(NodeType::Alt));
+        node->kids.push_back(parseConcat());
+        while (!atEnd() && peek() == '|')
+        {
+            ++_pos;
+            node->kids.push_back(parseConcat());
+        }
+        if (node->kids.size() == 1)
+            return std::move(node->kids[0]);
+
+        measure(*node, _pos);
+        return node;
+    }
+
+    /// concat := repeat*
+    std::unique_ptr<Node> parseConcat()
+    {
+        std::unique_ptr<Node> node(new Node(NodeType::Concat));
+        while (!atEnd() && peek() != '|' && peek() != ')')
+            node->kids.push_back(parseRepeat());
+
+        if (node->kids.empty())
+            return std::unique_ptr<Node>(new Node(NodeType::Empty));
+        if (node->kids.size() == 1)
+            return std::move(node->kids[0]);
+
+        measure(*node, _pos);
+        return node;
+    }
+
+    /// repeat := atom ('*' | '+' | '?' | '{' bounds '}')*
+    std::unique_ptr<Node> parseRepeat()
+    {
+        std::unique_ptr<Node> node = parseAtom();
+        while (!atEnd())
+        {
+            size_t start = _pos;
+            unsigned min, max;
+            char c = peek();
+            if (c == '*')
+                min = 0, max = Inf;
+            else if (c == '+')
+                min = 1, max = Inf;
+            else if (c == '?')
+                min = 0, max = 1;
+            else if (c == '{')
+                parseBounds(min, max);
+            else
+                break;
+            if (c != '{')
+                ++_pos;
+
+            std::unique_ptr<Node> rep(new Node(NodeType::Repeat));
+            rep->min = min;
+            rep->max = max;
+            rep->kids.push_back(std::move(node));
+            measure(*rep, start);
+            node = std::move(rep);
+        }
+
+        return node;
+    }
+
+    /// bounds := '{' num '}' | '{' num ',' '}' | '{' num ',' num '}'
+    void parseBounds(unsigned& min, unsigned& max)
+    {
+        size_t start = _pos++;
+        min = parseNum();
+        max = min;
+        if (!atEnd() && peek() == ',')
+        {
+            ++_pos;
+            max = (!atEnd() && peek() == '}') ? Inf : parseNum();
+        }
+        if (atEnd() || peek() != '}')
+            throw RegexError("unterminated repetition", start);
+        ++_pos;
+
+        if (max < min)
+            throw RegexError("bad repetition bounds", start);
+    }
+
+    unsigned parseNum()
+    {
+        size_t start = _pos;
+        unsigned n = 0;
+        while (!atEnd() && peek() >= '0' && peek() <= '9')
+        {
+            n = n * 10 + unsigned(peek() - '0');
+            if (n > MaxRepeat)
+                throw RegexError("repetition is too large", start);
+            ++_pos;
+        }
+        if (_pos == start)
+            throw RegexError("number expected", _pos);
+
+        return n;
+    }
+
+    /// atom := '(' alt ')' | '[' class ']' | '.' | '\' escape | byte
+    std::unique_ptr<Node> parseAtom()
+    {
+        size_t start = _pos;
+        char c = _re[_pos++];
+        switch (c)
+        {
+        case '(':
+        {
+            if (++_nesting > MaxDepth)
+                throw RegexError("nesting is too deep", start);
+            std::unique_ptr<Node> node = parseAlt();
+            if (atEnd() || peek() != ')')
+                throw RegexError("unmatched '('", start);
+            ++_pos;
+            --_nesting;
+            return node;
+        }
+        case '[':
+            return makeBytes(parseClass(start));
+        case '.':
+        {
+            ByteSet bs;
+            bs.set();
+            bs.reset((unsigned char)'\n');
+            return makeBytes(bs);
+        }
+        case '\\':
+            return makeBytes(parseEscape());
+        case '*': case '+': case '?': case '{':
+            throw RegexError("nothing to repeat", start);
+        default:
+        {
+            ByteSet bs;
+            bs.set((unsigned char)c);
+            return makeBytes(bs);
+        }
+        }
+    }
+
+    /// class := '^'? item+ ']', where the opening '[' is already consumed
+    ByteSet parseClass(size_t start)
+    {
+        bool neg = false;
+        if (!atEnd() && peek() == '^')
+        {
+            neg = true;
+            ++_pos;
+        }
+
+        ByteSet bs;
+        bool firstItem = true;
+        while (!atEnd() && (peek() != ']' || firstItem))
+        {
+            firstItem = false;
+
+            ByteSet item;
+            unsigned char lo;
+            if (peek() == '\\')
+            {
+                ++_pos;
+                item = parseEscape();
+                if (item.count() != 1)
+                {
+                    bs |= item;
+                    continue;
+                }
+                lo = (unsigned char)firstByte(item);
+            }
+            else
+                lo = (unsigned char)_re[_pos++];
+
+            // range
+            if (_pos + 1 < _re.size() && peek() == '-' && _re[_pos + 1] != ']')
+            {
+                size_t rangePos = _pos++;
+                unsigned char hi;
+                if (peek() == '\\')
+                {
+                    ++_pos;
+                    ByteSet h = parseEscape();
+                    if (h.count() != 1)
+                        throw RegexError("bad range", rangePos);
+                    hi = (unsigned char)firstByte(h);
+                }
+                else
+                    hi = (unsigned char)_re[_pos++];
+                if (hi < lo)
+                    throw RegexError("bad range", rangePos);
+                for (unsigned b = lo; b <= hi; ++b)
+                    bs.set(b);
+            }
+            else
+                bs.set(lo);
+        }
+        if (atEnd())
+            throw RegexError("unterminated character class", start);
+        ++_pos;
+
+        if (neg)
+            bs.flip();
+
+        return bs;
+    }
+
+    /// Parses an escape sequence, where the backslash is already consumed.
+    ByteSet parseEscape()
+    {
+        if (atEnd())
+            throw RegexError("trailing backslash", _pos - 1);
+
+        ByteSet bs;
+        char c = _re[_pos++];
+        switch (c)
+        {
+        case 'd': case 'D':
+            for (unsigned b = '0'; b <= '9'; ++b)
+                bs.set(b);
+            break;
+        case 'w': case 'W':
+            for (unsigned b = 0; b < 256; ++b)
+                bs[b] = std::isalnum(int(b)) || b == '_';
+            break;
+        case 's': case 'S':
+            for (char b : std::string(" \t\n\r\f\v"))
+                bs.set((unsigned char)b);
+            break;
+        case 'n': bs.set('\n'); break;
+        case 'r': bs.set('\r'); break;
+        case 't': bs.set('\t'); break;
+        case 'x':
+        {
+            size_t start = _pos - 2;
+            if (_pos + 2 > _re.size()
+                    || !std::isxdigit((unsigned char)_re[_pos])
+                    || !std::isxdigit((unsigned char)_re[_pos + 1]))
+                throw RegexError("bad hex escape", start);
+            bs.set(std::stoul(_re.substr(_pos, 2), nullptr, 16));
+            _pos += 2;
+            break;
+        }
+        default:
+            if (std::isalnum((unsigned char)c))
+                throw RegexError("unknown escape", _pos - 2);
+            bs.set((unsigned char)c);
+        }
+
+        if (c == 'D' || c == 'W' || c == 'S')
+            bs.flip();
+
+        return bs;
+    }
+
+    static unsigned firstByte(const ByteSet& bs)
+    {
+        for (unsigned b = 0; b < 256; ++b)
+        {
+            if (bs[b])
+                return b;
+        }
+        return 0;
+    }
+
+    /// Counts the states and the depth of the tree of \a node made at
+    /// the position \a pos from its children.
+    /// \throws RegexError if either exceeds its limit.
+    void measure(Node& node, size_t pos) const
+    {
+        size_t kidsNum = 0;
+        unsigned depth = 0;
+        for (const auto& kid : node.kids)
+        {
+            kidsNum = addStates(kidsNum, kid->statesNum, pos);
+            depth = std::max(depth, kid->depth);
+        }
+
+        if (node.type == NodeType::Repeat)
+        {
+            // emit() makes max copies, or min copies and a loop
+            size_t copies = (node.max == Inf) ? size_t(node.min) + 1
+                                              : size_t(node.max);
+            if (kidsNum != 0 && copies > _maxStates / kidsNum)
+                throw RegexError("too many states", pos);
+            kidsNum *= copies;
+        }
+
+        node.statesNum = addStates(kidsNum, 2, pos);
+        node.depth = depth + 1;
+        if (node.depth > MaxDepth)
+            throw RegexError("nesting is too deep", pos);
+    }
+
+    /// \return sum of the numbers of states \a a and \a b.
+    /// \throws RegexError at the position \a pos if it exceeds the budget.
+    size_t addStates(size_t a, size_t b, size_t pos) const
+    {
+        if (a > _maxStates || b > _maxStates - a)
+            throw RegexError("too many states", pos);
+
+        return a + b;
+    }
+
+    static std::unique_ptr<Node> makeBytes(const ByteSet& bs)
+    {
+        std::unique_ptr<Node> node(new Node(NodeType::Bytes));
+        node->bytes = bs;
+        return node;
+    }
+
+    /// Emits Thompson's construction for the node \a node into \a nfa with
+    /// new states numbered from \a next.
+    static Frag emit(const Node& node, IntCharNfa& nfa, int& next)
+    {
+        int in = next++;
+        int out = next++;
+        nfa.addState(in);
+        nfa.addState(out);
+
+        switch (node.type)
+        {
+        case NodeType::Empty:
+            nfa.addEpsTrans(in, out);
+            break;
+        case NodeType::Bytes:
+            for (unsigned b = 0; b < 256; ++b)
+            {
+                if (node.bytes[b])
+                    nfa.addTrans(in, char(b), out);
+            }
+            break;
+        case NodeType::Concat:
+        {
+            int cur = in;
+            for (const auto& kid : node.kids)
+            {
+                Frag f = emit(*kid, nfa, next);
+                nfa.addEpsTrans(cur, f.first);
+                cur = f.second;
+            }
+            nfa.addEpsTrans(cur, out);
+            break;
+        }
+        case NodeType::Alt:
+            for (const auto& kid : node.kids)
+            {
+                Frag f = emit(*kid, nfa, next);
+                nfa.addEpsTrans(in, f.first);
+                nfa.addEpsTrans(f.second, out);
+            }
+            break;
+        case NodeType::Repeat:
+        {
+            // mandatory copies
+            int cur = in;
+            for (unsigned i = 0; i < node.min; ++i)
+            {
+                Frag f = emit(*node.kids[0], nfa, next);
+                nfa.addEpsTrans(cur, f.first);
+                cur = f.second;
+            }
+
+            if (node.max == Inf)
+            {
+                // unbounded tail: a loop
+                Frag f = emit(*node.kids[0], nfa, next);
+                nfa.addEpsTrans(cur, f.first);
+                nfa.addEpsTrans(f.second, cur);
+                nfa.addEpsTrans(cur, out);
+            }
+            else
+            {
+                // optional copies, each one can skip to the exit
+                for (unsigned i = node.min; i < node.max; ++i)
+                {
+                    nfa.addEpsTrans(cur, out);
+                    Frag f = emit(*node.kids[0], nfa, next);
+                    nfa.addEpsTrans(cur, f.first);
+                    cur = f.second;
+                }
+                nfa.addEpsTrans(cur, out);
+            }
+            break;
+        }
+        }
+
+        return {in, out};
+    }
+
+protected:
+    const std::string& _re;             ///< Pattern.
+    size_t _pos;                        ///< Current position in the pattern.
+    size_t _maxStates;                  ///< Budget of states of the NFA.
+    unsigned _nesting;                  ///< Number of open groups.
+}; // class RegexCompiler
+
+
+
+#endif // REGEX_HPP_
@@ -0,0 +1,128 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains declarations of the types for sharing DFAs by threads.
+/// \author     DFA library contributors
+/// \version    0.1.0
+/// \date       16.10.2026
+/// \copyright  © DFA library contributors 2026.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef SHARED_DFA_HPP_
+#define SHARED_DFA_HPP_
+
+
+#include <memory>
+#include <utility>
+
+#include "compiled_dfa.hpp"
+
+
+
+/*! ****************************************************************************
+ *  \brief SharedDfa is a reference-counted handle of an immutable compiled
+ *  DFA, which is safe to share by threads.
+ *
+ *  The automaton is constant since it is made and is destroyed with the last
+ *  handle or player referring to it. Copying a handle is cheap and is safe
+ *  from any thread; the automaton itself is only read by players, see
+ *  CompiledDfa. Every thread must use players of its own.
+ *
+ *  \tparam State is a data type for representing states.
+ *  \tparam Alpha represent elements of the alphabet of an automaton.
+ ******************************************************************************/
+template<typename State, typename Alpha>
+class SharedDfa {
+public:
+    // aliases for State and Alpha
+    typedef State TState;
+    typedef Alpha TAlpha;
+
+    /// Specified compiled DFA.
+    typedef CompiledDfa<State, Alpha> SpecCompiledDfa;
+
+public:
+    // Constructors and all.
+
+    /// Compiles the automaton \a dfa.
+    explicit SharedDfa(const Dfa<State, Alpha>& dfa)
+        : _dfa(std::make_shared<const SpecCompiledDfa>(dfa))
+    {
+    }
+
+    /// Takes over the compiled automaton \a dfa, e.g. loaded from an image.
+    explicit SharedDfa(SpecCompiledDfa&& dfa)
+        : _dfa(std::make_shared<const SpecCompiledDfa>(std::move(dfa)))
+    {
+    }
+
+public:
+
+    /// \return the automaton.
+    const SpecCompiledDfa& get() const { return *_dfa; }
+
+    const SpecCompiledDfa& operator*() const { return *_dfa; }
+    const SpecCompiledDfa* operator->() const { return _dfa.get(); }
+
+    /// \return number of handles and players referring to the automaton.
+    long getUseCount() const { return _dfa.use_count(); }
+
+protected:
+    std::shared_ptr<const SpecCompiledDfa> _dfa;    ///< Shared automaton.
+}; // class SharedDfa
+
+
+/*! ****************************************************************************
+ *  \brief Player used to replay strings in a shared compiled automaton, which
+ *  keeps the automaton alive.
+ *
+ *  A player is lightweight and must not be shared by threads; the automaton
+ *  may be shared by any number of players.
+ *
+ *  \tparam State is a data type for representing states.
+ *  \tparam Alpha represent elements of the alphabet of an automaton.
+ *  \tparam Listener is a listener policy type, see BasicCompiledDfaPlayer.
+ ******************************************************************************/
+template<typename State, typename Alpha, typename Listener = NullListener>
+class SharedDfaPlayer : public BasicCompiledDfaPlayer<State, Alpha, Listener> {
+public:
+    /// Base player.
+    typedef BasicCompiledDfaPlayer<State, Alpha, Listener> Base;
+
+    /// Handle of the automaton.
+    typedef SharedDfa<State, Alpha> SpecSharedDfa;
+
+public:
+    // Constructors and all.
+
+    /// Inititalizes a player with a shared automaton and a listener.
+    explicit SharedDfaPlayer(const SpecSharedDfa& dfa,
+                             Listener listener = Listener())
+        : Base(*dfa, listener)          // the handle keeps the object alive
+        , _owner(dfa)
+    {
+    }
+
+    SharedDfaPlayer(const SharedDfaPlayer&) = default;
+
+    // the base refers to the automaton, which cannot be rebound
+    SharedDfaPlayer& operator=(const SharedDfaPlayer&) = delete;
+
+public:
+
+    /// \return handle of the automaton.
+    const SpecSharedDfa& getDfa() const { return _owner; }
+
+protected:
+    SpecSharedDfa _owner;               ///< Handle keeping the automaton.
+}; // class SharedDfaPlayer
+
+
+
+#endif // SHARED_DFA_HPP_
@@ -0,0 +1,407 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains declarations of the types for shuffle-based DFAs of
+///             few states.
+/// \author     DFA library contributors
+/// \version    0.1.0
+/// \date       16.10.2026
+/// \copyright  © DFA library contributors 2026.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef SHENG_DFA_HPP_
+#define SHENG_DFA_HPP_
+
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include "compiled_dfa.hpp"
+#include "simd.hpp"
+
+
+
+/*! ****************************************************************************
+ *  \brief ShengDfa is a compiled DFA of at most 64 states, whose transitions
+ *  by a symbol class fit a single vector register.
+ *
+ *  A row of the class c is a vector of getWidth() bytes, whose byte s is
+ *  the index of the state reached from s by c; a step of a replay is then
+ *  a single byte shuffle of the row by the current state: `pshufb` (SSSE3)
+ *  for rows of 16 bytes and `vpermb` (AVX-512 VBMI) for rows of 64 bytes.
+ *  The row is loaded by the symbol only, so the loop carries nothing but
+ *  the shuffle ("Sheng" technique).
+ *
+ *  Missing transitions and unknown symbols lead to an extra dead state, which
+ *  loops on all the symbols and needs a byte of its own unless there are no
+ *  missing transitions and every value of Alpha is a symbol. States keep
+ *  their indices of the CompiledDfa, which is referred to, not copied, so it
+ *  must outlive the automaton, as it must outlive its players.
+ *
+ *  \tparam State is a data type for representing states.
+ *  \tparam Alpha represent elements of the alphabet of an automaton.
+ ******************************************************************************/
+template<typename State, typename Alpha>
+class ShengDfa {
+public:
+    // aliases for State and Alpha
+    typedef State TState;
+    typedef Alpha TAlpha;
+
+    /// Specified compiled DFA.
+    typedef CompiledDfa<State, Alpha> SpecCompiledDfa;
+
+    /// Index type of the compiled DFA.
+    typedef typename SpecCompiledDfa::Index Index;
+
+    /// Width of rows shuffled by SSSE3.
+    static constexpr size_t NarrowWidth = 16;
+
+    /// Width of rows shuffled by AVX-512 VBMI.
+    static constexpr size_t WideWidth = 64;
+
+public:
+    // Constructors and all.
+
+    /// Builds the rows of \a dfa for the strongest supported instruction set
+    /// up to \a level.
+    /// \throws std::invalid_argument if \a dfa has too many states for
+    /// the rows, see isApplicable().
+    explicit ShengDfa(const SpecCompiledDfa& dfa,
+                      SimdLevel level = detectSimdLevel())
+        : _dfa(dfa)
+        , _level(SimdLevel::None)
+    {
+        const size_t statesNum = getRowStatesNum(dfa);
+        if (statesNum <= NarrowWidth)
+        {
+            _width = NarrowWidth;
+            if (level >= SimdLevel::Ssse3 && isSimdSupported(SimdLevel::Ssse3))
+                _level = SimdLevel::Ssse3;
+        }
+        else if (statesNum <= WideWidth && level >= SimdLevel::Avx512Vbmi
+                 && isSimdSupported(SimdLevel::Avx512Vbmi))
+        {
+            _width = WideWidth;
+            _level = SimdLevel::Avx512Vbmi;
+        }
+        else
+            throw std::invalid_argument("too many states for a Sheng DFA");
+
+        // the dead state follows the states, unless it is not needed, so it
+        // is never reached; unused bytes lead to it too
+        const size_t classesNum = dfa.getClassesNum();
+        _dead = Index((statesNum > dfa.getStatesNum()) ? dfa.getStatesNum()
+                                                       : _width);
+        _rows.assign((classesNum + 1) * _width, std::uint8_t(_dead));
+        for (Index c = 0; c < classesNum; ++c)
+        {
+            for (Index s = 0; s < dfa.getStatesNum(); ++s)
+            {
+                Index d = dfa.getTransIndex(s, c);
+                if (d != SpecCompiledDfa::NoTrans)
+                    _rows[c * _width + s] = std::uint8_t(d);
+            }
+        }
+
+        // a direct table saves clamping unknown classes in the loop
+        if constexpr (SpecCompiledDfa::HasClassTable)
+        {
+            const Index* classes = dfa.getClassTable();
+            _symbolRows.resize(SymbolClassRange);
+            for (size_t a = 0; a < SymbolClassRange; ++a)
+                _symbolRows[a] = std::min(classes[a], Index(classesNum));
+        }
+    }
+
+    /// The compiled automaton is referred to, so it cannot be a temporary.
+    explicit ShengDfa(const SpecCompiledDfa&& dfa,
+                      SimdLevel level = detectSimdLevel()) = delete;
+
+public:
+
+    /// \return true if \a dfa fits the rows supported by the instruction set
+    /// \a level: up to 16 states for SSSE3, up to 64 states for AVX-512 VBMI,
+    /// including the dead state if needed.
+    static bool isApplicable(const SpecCompiledDfa& dfa,
+                             SimdLevel level = detectSimdLevel())
+    {
+        size_t statesNum = getRowStatesNum(dfa);
+        if (level >= SimdLevel::Avx512Vbmi
+                && isSimdSupported(SimdLevel::Avx512Vbmi))
+            return statesNum <= WideWidth;
+
+        return level >= SimdLevel::Ssse3 && isSimdSupported(SimdLevel::Ssse3)
+               && statesNum <= NarrowWidth;
+    }
+
+    /// \return number of states \a dfa takes in rows, including the dead one.
+    static size_t getRowStatesNum(const SpecCompiledDfa& dfa)
+    {
+        bool dead = true;
+        if constexpr (SpecCompiledDfa::HasClassTable)
+        {
+            const Index* classes = dfa.getClassTable();
+            const size_t range = SymbolClassRange;
+            dead = std::find(classes, classes + range, NoInternId)
+                    != classes + range;
+        }
+
+        const Index* table = dfa.getTransTable();
+        const Index* end = table + dfa.getStatesNum() * dfa.getClassesNum();
+        if (std::find(table, end, SpecCompiledDfa::NoTrans) != end)
+            dead = true;
+
+        return dfa.getStatesNum() + (dead ? 1 : 0);
+    }
+
+    /// \return the compiled automaton.
+    const SpecCompiledDfa& getCompiledDfa() const { return _dfa; }
+
+    /// \return number of bytes in a row.
+    size_t getWidth() const { return _width; }
+
+    /// \return instruction set of shuffles, None if there is no support.
+    SimdLevel getSimdLevel() const { return _level; }
+
+    /// \return index of the dead state, not less than getWidth() if
+    /// the automaton has none.
+    Index getDeadIndex() const { return _dead; }
+
+    /// \return number of the row of the symbol \a a; unknown symbols have
+    /// the last row, leading to the dead state.
+    Index getRowIndex(Alpha a) const
+    {
+        if constexpr (SpecCompiledDfa::HasClassTable)
+            return _symbolRows[std::make_unsigned_t<Alpha>(a)];
+        else
+        {
+            Index c;
+            return _dfa.getSymbolClass(a, c) ? c
+                                             : Index(_dfa.getClassesNum());
+        }
+    }
+
+    /// \return the row with the number \a r.
+    const std::uint8_t* getRow(Index r) const
+    {
+        return _rows.data() + r * _width;
+    }
+
+protected:
+    /// Number of values of Alpha, if it has a direct table of classes.
+    static constexpr size_t SymbolClassRange =
+            size_t(1) << (SpecCompiledDfa::HasClassTable ? sizeof(Alpha) * 8
+                                                         : 0);
+
+protected:
+    const SpecCompiledDfa& _dfa;        ///< Ref to the compiled automaton.
+    SimdLevel _level;                   ///< Instruction set of shuffles.
+    size_t _width;                      ///< Number of bytes in a row.
+    Index _dead;                        ///< Index of the dead state.
+    std::vector<std::uint8_t> _rows;    ///< Rows of classes, and unknown.
+    std::vector<Index> _symbolRows;     ///< Rows of symbols, if direct.
+}; // class ShengDfa
+
+
+template<typename State, typename Alpha>
+constexpr size_t ShengDfa<State, Alpha>::NarrowWidth;
+
+template<typename State, typename Alpha>
+constexpr size_t ShengDfa<State, Alpha>::WideWidth;
+
+
+/*! ****************************************************************************
+ *  \brief Player used to replay a given string in a ShengDfa.
+ *
+ *  Provides the same semantics as BasicCompiledDfaPlayer with NullListener
+ *  does. Symbols are shuffled in blocks of BlockLen; a block that ends in
+ *  the dead state is replayed again by scalar lookups, to find the symbol
+ *  missing a transition and the state it is missing in.
+ *
+ *  \tparam State is a data type for representing states.
+ *  \tparam Alpha represent elements of the alphabet of an automaton.
+ ******************************************************************************/
+template<typename State, typename Alpha>
+class ShengDfaPlayer {
+public:
+    // aliases for State and Alpha
+    typedef State TState;
+    typedef Alpha TAlpha;
+
+    /// Specified Sheng DFA.
+    typedef ShengDfa<State, Alpha> SpecShengDfa;
+
+    /// Index type of the compiled DFA.
+    typedef typename SpecShengDfa::Index Index;
+
+    /// Results of replaying (shared with DfaPlayer).
+    typedef PlayResult Result;
+
+    /// Number of symbols between checks for the dead state.
+    static constexpr size_t BlockLen = 256;
+
+public:
+    // Constructors and all.
+
+    /// Inititalizes a player with an automaton.
+    explicit ShengDfaPlayer(const SpecShengDfa& dfa)
+        : _dfa(dfa)
+        , _curState(dfa.getCompiledDfa().getInitIndex())
+        , _curPos(0)
+        , _lastSymb(Alpha())
+    {
+    }
+
+public:
+
+    /// Plays a sequence of \a len symbols stored at \a seq.
+    /// \return the same result as BasicCompiledDfaPlayer::play() does.
+    Result play(const Alpha* seq, size_t len)
+    {
+        const SpecShengDfa& dfa = _dfa;
+        Index s = dfa.getCompiledDfa().getInitIndex();
+
+        // starts over as BasicCompiledDfaPlayer::init() does
+        _curState = s;
+        _curPos = 0;
+        _lastSymb = Alpha();
+        for (size_t pos = 0; pos < len; pos += BlockLen)
+        {
+            size_t n = std::min(BlockLen, len - pos);
+            Index d = runBlock(seq + pos, n, s);
+            if (d == dfa.getDeadIndex())
+            {
+                findDead(seq + pos, s, pos);
+                return Result::NoTrans;
+            }
+            s = d;
+        }
+
+        _curState = s;
+        _curPos = len;
+        if (len != 0)
+            _lastSymb = seq[len - 1];
+
+        return dfa.getCompiledDfa().isFinIndex(s) ? Result::Ok
+                                                  : Result::NonFinState;
+    }
+
+    /// Plays a sequence provided as a string view.
+    template<typename Traits>
+    Result play(std::basic_string_view<Alpha, Traits> seq)
+    {
+        return play(seq.data(), seq.size());
+    }
+
+    /// Plays a sequence provided as a vector.
+    Result play(const std::vector<Alpha>& seq)
+    {
+        return play(seq.data(), seq.size());
+    }
+
+    /// Returns state being visited.
+    State getCurState() const
+    {
+        return _dfa.getCompiledDfa().getState(_curState);
+    }
+
+    /// Returns index of the state being visited.
+    Index getCurIndex() const { return _curState; }
+
+    /// Returns current position in the replayed sequence.
+    std::uint64_t getCurPos() const { return _curPos; }
+
+    /// Returns the last considered symbol.
+    Alpha getLastSymbol() const { return _lastSymb; }
+
+protected:
+    /// Replays \a n symbols stored at \a seq from the state \a s.
+    /// \return the reached state.
+    Index runBlock(const Alpha* seq, size_t n, Index s) const
+    {
+#if FSA_X86_SIMD
+        if (_dfa.getSimdLevel() == SimdLevel::Avx512Vbmi)
+            return runVbmi(seq, n, s);
+        if (_dfa.getSimdLevel() == SimdLevel::Ssse3)
+            return runSsse3(seq, n, s);
+#endif
+        for (size_t i = 0; i < n; ++i)
+            s = _dfa.getRow(_dfa.getRowIndex(seq[i]))[s];
+
+        return s;
+    }
+
+    /// Replays the block at \a seq at the position \a pos from the state \a s
+    /// up to the dead state and stores where the replay breaks off.
+    void findDead(const Alpha* seq, Index s, size_t pos)
+    {
+        for ( ; ; ++seq, ++pos)
+        {
+            Index d = _dfa.getRow(_dfa.getRowIndex(*seq))[s];
+            if (d == _dfa.getDeadIndex())
+                break;
+            s = d;
+        }
+
+        _curState = s;
+        _curPos = pos;
+        _lastSymb = *seq;
+    }
+
+#if FSA_X86_SIMD
+    /// Replays a block by SSSE3 shuffles of rows of 16 bytes.
+    __attribute__((target("ssse3")))
+    Index runSsse3(const Alpha* seq, size_t n, Index s) const
+    {
+        // only the byte 0 of the state vector is meaningful
+        __m128i v = _mm_cvtsi32_si128(int(s));
+        for (size_t i = 0; i < n; ++i)
+        {
+            const __m128i* row = reinterpret_cast<const __m128i*>(
+                        _dfa.getRow(_dfa.getRowIndex(seq[i])));
+            v = _mm_shuffle_epi8(_mm_loadu_si128(row), v);
+        }
+
+        return Index(_mm_cvtsi128_si32(v) & 0xff);
+    }
+
+    /// Replays a block by AVX-512 VBMI permutations of rows of 64 bytes.
+    __attribute__((target("avx512f,avx512bw,avx512vbmi")))
+    Index runVbmi(const Alpha* seq, size_t n, Index s) const
+    {
+        // only the byte 0 of the state vector is meaningful
+        __m512i v = _mm512_castsi128_si512(_mm_cvtsi32_si128(int(s)));
+        for (size_t i = 0; i < n; ++i)
+        {
+            const void* row = _dfa.getRow(_dfa.getRowIndex(seq[i]));
+            v = _mm512_permutexvar_epi8(v, _mm512_loadu_si512(row));
+        }
+
+        return Index(_mm_cvtsi128_si32(_mm512_castsi512_si128(v)) & 0xff);
+    }
+#endif
+
+protected:
+    const SpecShengDfa& _dfa;           ///< Ref to the automaton.
+    Index _curState;                    ///< Index of the current state.
+    std::uint64_t _curPos;              ///< Currently replayed symbol.
+    Alpha _lastSymb;                    ///< Stores last replayed symbol.
+}; // class ShengDfaPlayer
+
+
+template<typename State, typename Alpha>
+constexpr size_t ShengDfaPlayer<State, Alpha>::BlockLen;
+
+
+
+#endif // SHENG_DFA_HPP_
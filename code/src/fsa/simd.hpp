@@ -0,0 +1,101 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains declarations for choosing SIMD code at runtime.
+/// \author     DFA library contributors
+/// \version    0.1.0
+/// \date       16.10.2026
+/// \copyright  © DFA library contributors 2026.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef SIMD_HPP_
+#define SIMD_HPP_
+
+
+// x86 SIMD code is compiled by GCC and Clang with per-function target
+// attributes, so the build needs no -m flags and the code runs everywhere;
+// a function is called only if the CPU supports its instruction set
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FSA_X86_SIMD 1
+#include <immintrin.h>
+#else
+#define FSA_X86_SIMD 0
+#endif
+
+
+
+/// Instruction sets of SIMD code, from the weakest one.
+enum class SimdLevel {
+    None,                               ///< Scalar code only.
+    Ssse3,                              ///< SSSE3 (pshufb).
+    Avx2,                               ///< AVX2 (gathers).
+    Avx512,                             ///< AVX-512 F and BW.
+    Avx512Vbmi,                         ///< AVX-512 VBMI (vpermb).
+}; // enum class SimdLevel
+
+
+/// \return true if the CPU supports the instruction set \a level.
+inline bool isSimdSupported(SimdLevel level)
+{
+#if FSA_X86_SIMD
+    switch (level)
+    {
+    case SimdLevel::None:
+        return true;
+    case SimdLevel::Ssse3:
+        return __builtin_cpu_supports("ssse3");
+    case SimdLevel::Avx2:
+        return __builtin_cpu_supports("avx2");
+    case SimdLevel::Avx512:
+        return __builtin_cpu_supports("avx512f")
+               && __builtin_cpu_supports("avx512bw");
+    case SimdLevel::Avx512Vbmi:
+        return isSimdSupported(SimdLevel::Avx512)
+               && __builtin_cpu_supports("avx512vbmi");
+    }
+    return false;
+#else
+    return level == SimdLevel::None;
+#endif
+}
+
+/// \return the strongest instruction set the CPU supports.
+inline SimdLevel detectSimdLevel()
+{
+    for (SimdLevel level : { SimdLevel::Avx512Vbmi, SimdLevel::Avx512,
+                             SimdLevel::Avx2, SimdLevel::Ssse3 })
+    {
+        if (isSimdSupported(level))
+            return level;
+    }
+
+    return SimdLevel::None;
+}
+
+/// \return name of the instruction set \a level.
+inline const char* getSimdName(SimdLevel level)
+{
+    switch (level)
+    {
+    case SimdLevel::Ssse3:
+        return "ssse3";
+    case SimdLevel::Avx2:
+        return "avx2";
+    case SimdLevel::Avx512:
+        return "avx512";
+    case SimdLevel::Avx512Vbmi:
+        return "avx512vbmi";
+    default:
+        return "scalar";
+    }
+}
+
+
+
+#endif // SIMD_HPP_
@@ -0,0 +1,352 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains declarations of the types for DFAs consuming several
+///             symbols per step.
+/// \author     DFA library contributors
+/// \version    0.1.0
+/// \date       16.10.2026
+/// \copyright  © DFA library contributors 2026.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef STRIDE_DFA_HPP_
+#define STRIDE_DFA_HPP_
+
+
+#include <algorithm>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "compiled_dfa.hpp"
+
+
+
+/*! ****************************************************************************
+ *  \brief StrideDfa is a compiled DFA whose transition table is indexed by
+ *  strings of getStride() symbol classes, so a step consumes that many
+ *  symbols with a single dependent load.
+ *
+ *  Unknown symbols get an extra class of their own, so a column is made of
+ *  `(classes + 1)^stride` strings. A string that misses a transition somewhere
+ *  leads to NoTrans as a whole; the player then replays it symbol by symbol
+ *  to find the exact position.
+ *
+ *  The stride is the largest of 4, 2 and 1 whose table fits the given size
+ *  budget in bytes. The CompiledDfa is referred to, not copied, so it must
+ *  outlive the automaton, as it must outlive its players.
+ *
+ *  \tparam State is a data type for representing states.
+ *  \tparam Alpha represent elements of the alphabet of an automaton.
+ ******************************************************************************/
+template<typename State, typename Alpha>
+class StrideDfa {
+public:
+    // aliases for State and Alpha
+    typedef State TState;
+    typedef Alpha TAlpha;
+
+    /// Specified compiled DFA.
+    typedef CompiledDfa<State, Alpha> SpecCompiledDfa;
+
+    /// Index type of the compiled DFA.
+    typedef typename SpecCompiledDfa::Index Index;
+
+    /// Default size budget of a table, in bytes; larger tables miss L2.
+    static constexpr size_t DefBudget = size_t(1) << 18;
+
+    /// Maximum number of symbols per step.
+    static constexpr size_t MaxStride = 4;
+
+public:
+    // Constructors and all.
+
+    /// Builds the table of the largest stride of \a dfa fitting \a budget.
+    explicit StrideDfa(const SpecCompiledDfa& dfa, size_t budget = DefBudget)
+        : _dfa(dfa)
+        , _stride(chooseStride(dfa, budget))
+        , _width(dfa.getClassesNum() + 1)
+    {
+        // a table of stride 2k maps a state by a string ab of k-strings a
+        // and b through the table of stride k
+        const size_t statesNum = dfa.getStatesNum();
+        const Index none = SpecCompiledDfa::NoTrans;
+        std::vector<Index> table(statesNum * _width, none);
+        for (Index s = 0; s < statesNum; ++s)
+        {
+            for (Index c = 0; c + 1 < _width; ++c)
+                table[s * _width + c] = dfa.getTransIndex(s, c);
+        }
+
+        for (size_t k = 1; k < _stride; k *= 2)
+        {
+            const size_t width = _width * _width;
+            std::vector<Index> next(statesNum * width, none);
+            for (Index s = 0; s < statesNum; ++s)
+            {
+                for (size_t a = 0; a < _width; ++a)
+                {
+                    Index m = table[s * _width + a];
+                    if (m == none)
+                        continue;
+                    std::copy(&table[m * _width], &table[m * _width] + _width,
+                              &next[s * width + a * _width]);
+                }
+            }
+            table.swap(next);
+            _width = width;
+        }
+        _table = std::move(table);
+
+        // unknown symbols have the last class
+        const Index unknown = Index(dfa.getClassesNum());
+        if constexpr (SpecCompiledDfa::HasClassTable)
+        {
+            const Index* classes = dfa.getClassTable();
+            _symbolClasses.resize(SymbolClassRange);
+            for (size_t a = 0; a < SymbolClassRange; ++a)
+                _symbolClasses[a] = std::min(classes[a], unknown);
+        }
+    }
+
+    /// The compiled automaton is referred to, so it cannot be a temporary.
+    explicit StrideDfa(const SpecCompiledDfa&& dfa,
+                       size_t budget = DefBudget) = delete;
+
+public:
+
+    /// \return the largest stride whose table for \a dfa fits \a budget bytes.
+    static size_t chooseStride(const SpecCompiledDfa& dfa, size_t budget)
+    {
+        const size_t rowsNum = dfa.getStatesNum();
+        size_t stride = 1;
+        size_t width = dfa.getClassesNum() + 1;
+        while (stride < MaxStride)
+        {
+            // the doubled stride has width^2 strings; checked for overflows
+            if (width > budget / width
+                    || rowsNum > budget / sizeof(Index) / (width * width))
+                break;
+            width *= width;
+            stride *= 2;
+        }
+
+        return stride;
+    }
+
+    /// \return the compiled automaton.
+    const SpecCompiledDfa& getCompiledDfa() const { return _dfa; }
+
+    /// \return number of symbols consumed per step.
+    size_t getStride() const { return _stride; }
+
+    /// \return number of strings of classes, i.e. the width of a row.
+    size_t getWidth() const { return _width; }
+
+    /// \return size of the table in bytes.
+    size_t getTableSize() const { return _table.size() * sizeof(Index); }
+
+    /// \return class of the symbol \a a; unknown symbols have the class
+    /// getClassesNum() of the compiled automaton.
+    Index getClass(Alpha a) const
+    {
+        if constexpr (SpecCompiledDfa::HasClassTable)
+            return _symbolClasses[std::make_unsigned_t<Alpha>(a)];
+        else
+        {
+            Index c;
+            return _dfa.getSymbolClass(a, c) ? c
+                                             : Index(_dfa.getClassesNum());
+        }
+    }
+
+    /// \return index of the state reached from the state \a s by the string
+    /// of classes \a str, or NoTrans if some transition is missing.
+    Index getTransIndex(Index s, size_t str) const
+    {
+        return _table[s * _width + str];
+    }
+
+protected:
+    /// Number of values of Alpha, if it has a direct table of classes.
+    static constexpr size_t SymbolClassRange =
+            size_t(1) << (SpecCompiledDfa::HasClassTable ? sizeof(Alpha) * 8
+                                                         : 0);
+
+protected:
+    const SpecCompiledDfa& _dfa;        ///< Ref to the compiled automaton.
+    size_t _stride;                     ///< Number of symbols per step.
+    size_t _width;                      ///< Number of strings of classes.
+    std::vector<Index> _table;          ///< Table of strings of classes.
+    std::vector<Index> _symbolClasses;  ///< Classes of symbols, if direct.
+}; // class StrideDfa
+
+
+template<typename State, typename Alpha>
+constexpr size_t StrideDfa<State, Alpha>::DefBudget;
+
+template<typename State, typename Alpha>
+constexpr size_t StrideDfa<State, Alpha>::MaxStride;
+
+
+/*! ****************************************************************************
+ *  \brief Player used to replay a given string in a StrideDfa.
+ *
+ *  Provides the same semantics as BasicCompiledDfaPlayer with NullListener
+ *  does. The sequence is replayed by strides while they have transitions;
+ *  the rest, from the first stride missing a transition or a tail shorter
+ *  than a stride, is replayed symbol by symbol.
+ *
+ *  \tparam State is a data type for representing states.
+ *  \tparam Alpha represent elements of the alphabet of an automaton.
+ ******************************************************************************/
+template<typename State, typename Alpha>
+class StrideDfaPlayer {
+public:
+    // aliases for State and Alpha
+    typedef State TState;
+    typedef Alpha TAlpha;
+
+    /// Specified stride DFA.
+    typedef StrideDfa<State, Alpha> SpecStrideDfa;
+
+    /// Specified compiled DFA.
+    typedef typename SpecStrideDfa::SpecCompiledDfa SpecCompiledDfa;
+
+    /// Index type of the compiled DFA.
+    typedef typename SpecStrideDfa::Index Index;
+
+    /// Results of replaying (shared with DfaPlayer).
+    typedef PlayResult Result;
+
+public:
+    // Constructors and all.
+
+    /// Inititalizes a player with an automaton.
+    explicit StrideDfaPlayer(const SpecStrideDfa& dfa)
+        : _dfa(dfa)
+        , _curState(dfa.getCompiledDfa().getInitIndex())
+        , _curPos(0)
+        , _lastSymb(Alpha())
+    {
+    }
+
+public:
+
+    /// Plays a sequence of \a len symbols stored at \a seq.
+    /// \return the same result as BasicCompiledDfaPlayer::play() does.
+    Result play(const Alpha* seq, size_t len)
+    {
+        const SpecCompiledDfa& cdfa = _dfa.getCompiledDfa();
+        Index s = cdfa.getInitIndex();
+
+        // starts over as BasicCompiledDfaPlayer::init() does
+        _curState = s;
+        _curPos = 0;
+        _lastSymb = Alpha();
+        size_t pos = 0;
+        switch (_dfa.getStride())
+        {
+        case 4:
+            pos = playStrides<4>(seq, len, s);
+            break;
+        case 2:
+            pos = playStrides<2>(seq, len, s);
+            break;
+        }
+
+        // the tail and the stride missing a transition
+        for ( ; pos < len; ++pos)
+        {
+            Index c = _dfa.getClass(seq[pos]);
+            Index d = (c < cdfa.getClassesNum()) ? cdfa.getTransIndex(s, c)
+                                                 : SpecCompiledDfa::NoTrans;
+            if (d == SpecCompiledDfa::NoTrans)
+            {
+                _curState = s;
+                _curPos = pos;
+                _lastSymb = seq[pos];
+                return Result::NoTrans;
+            }
+            s = d;
+        }
+
+        _curState = s;
+        _curPos = len;
+        if (len != 0)
+            _lastSymb = seq[len - 1];
+
+        return cdfa.isFinIndex(s) ? Result::Ok : Result::NonFinState;
+    }
+
+    /// Plays a sequence provided as a string view.
+    template<typename Traits>
+    Result play(std::basic_string_view<Alpha, Traits> seq)
+    {
+        return play(seq.data(), seq.size());
+    }
+
+    /// Plays a sequence provided as a vector.
+    Result play(const std::vector<Alpha>& seq)
+    {
+        return play(seq.data(), seq.size());
+    }
+
+    /// Returns state being visited.
+    State getCurState() const
+    {
+        return _dfa.getCompiledDfa().getState(_curState);
+    }
+
+    /// Returns index of the state being visited.
+    Index getCurIndex() const { return _curState; }
+
+    /// Returns current position in the replayed sequence.
+    std::uint64_t getCurPos() const { return _curPos; }
+
+    /// Returns the last considered symbol.
+    Alpha getLastSymbol() const { return _lastSymb; }
+
+protected:
+    /// Replays whole strides of \a Stride symbols of \a seq from the state
+    /// \a s while they have transitions and updates \a s.
+    /// \return position of the first symbol not replayed.
+    template<size_t Stride>
+    size_t playStrides(const Alpha* seq, size_t len, Index& s) const
+    {
+        // a single step's width is the number of classes with unknown one
+        size_t classesNum = _dfa.getCompiledDfa().getClassesNum() + 1;
+        Index state = s;
+        size_t pos = 0;
+        for ( ; pos + Stride <= len; pos += Stride)
+        {
+            size_t str = 0;
+            for (size_t i = 0; i < Stride; ++i)
+                str = str * classesNum + _dfa.getClass(seq[pos + i]);
+
+            Index d = _dfa.getTransIndex(state, str);
+            if (d == SpecCompiledDfa::NoTrans)
+                break;
+            state = d;
+        }
+        s = state;
+
+        return pos;
+    }
+
+protected:
+    const SpecStrideDfa& _dfa;          ///< Ref to the automaton.
+    Index _curState;                    ///< Index of the current state.
+    std::uint64_t _curPos;              ///< Currently replayed symbol.
+    Alpha _lastSymb;                    ///< Stores last replayed symbol.
+}; // class StrideDfaPlayer
+
+
+
+#endif // STRIDE_DFA_HPP_
@@ -0,0 +1,293 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains declarations of the type for a work-stealing pool.
+/// \author     DFA library contributors
+/// \version    0.1.0
+/// \date       16.10.2026
+/// \copyright  © DFA library contributors 2026.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef THREAD_POOL_HPP_
+#define THREAD_POOL_HPP_
+
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+
+/*! ****************************************************************************
+ *  \brief WorkStealingPool runs parallel loops over index ranges on a fixed
+ *  set of threads.
+ *
+ *  Every thread has a deque of ranges. A thread takes the newest range from
+ *  its own deque and splits it in halves until a single index is left,
+ *  pushing the other halves back; an idle thread steals the oldest, i.e. the
+ *  largest, range from another deque. A thread that finds nothing to steal
+ *  sleeps until a range is shared or the job is done. The thread calling
+ *  parallelFor() works as one of the threads of the pool.
+ ******************************************************************************/
+class WorkStealingPool {
+public:
+    // Constructors and all.
+
+    /// Makes a pool of \a threadsNum threads, including the calling one;
+    /// 0 means the number of hardware threads.
+    explicit WorkStealingPool(size_t threadsNum = 0)
+        : _queues(threadsNum ? threadsNum : defThreadsNum())
+        , _body(nullptr)
+        , _jobId(0)
+        , _left(0)
+        , _queuedNum(0)
+        , _idleNum(0)
+        , _busyNum(0)
+        , _stop(false)
+    {
+        for (size_t i = 1; i < _queues.size(); ++i)
+            _threads.emplace_back([this, i]() { runWorker(i); });
+    }
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    ~WorkStealingPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _wake.notify_all();
+        for (std::thread& t : _threads)
+            t.join();
+    }
+
+public:
+
+    /// \return number of threads, including the calling one.
+    size_t getThreadsNum() const { return _queues.size(); }
+
+    /// Calls \a body(i) for every i of [0, \a n) in parallel and returns when
+    /// all the calls are done. Calls of parallelFor() are serialized.
+    void parallelFor(size_t n, const std::function<void (size_t)>& body)
+    {
+        if (n == 0)
+            return;
+
+        std::lock_guard<std::mutex> jobLock(_jobMutex);
+
+        // deal the range out to the threads evenly
+        const size_t threadsNum = _queues.size();
+        for (size_t t = 0; t < threadsNum; ++t)
+        {
+            size_t first = n * t / threadsNum;
+            size_t last = n * (t + 1) / threadsNum;
+            if (first != last)
+            {
+                std::lock_guard<std::mutex> lock(_queues[t].mutex);
+                _queues[t].ranges.push_back({first, last});
+                ++_queuedNum;
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _body = &body;
+            _left.store(n, std::memory_order_relaxed);
+            ++_jobId;
+        }
+        _wake.notify_all();
+
+        work(0, body);
+
+        // the body must not be left to a thread still looking for work
+        std::unique_lock<std::mutex> lock(_mutex);
+        _done.wait(lock, [this]() { return _busyNum == 0; });
+        _body = nullptr;
+    }
+
+protected:
+    /// Range [first, last) of indices.
+    struct Range {
+        size_t first;
+        size_t last;
+    }; // struct Range
+
+    /// Deque of ranges of a thread.
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Range> ranges;
+    }; // struct Queue
+
+protected:
+    static size_t defThreadsNum()
+    {
+        size_t n = std::thread::hardware_concurrency();
+        return n ? n : 1;
+    }
+
+    /// Loop of a background thread with the number \a self.
+    void runWorker(size_t self)
+    {
+        std::uint64_t seenJob = 0;
+        for (;;)
+        {
+            // the body is taken with the job under the lock: once the job is
+            // done, parallelFor() resets it and the caller may destroy it
+            const std::function<void (size_t)>* body;
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _wake.wait(lock, [this, seenJob]()
+                           { return _stop || _jobId != seenJob; });
+                if (_stop)
+                    return;
+                seenJob = _jobId;
+                body = _body;
+                if (!body)
+                    continue;           // woken after the job is done
+                ++_busyNum;
+            }
+
+            work(self, *body);
+
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                --_busyNum;
+            }
+            _done.notify_all();
+        }
+    }
+
+    /// Processes ranges of the current job with the \a body as the thread
+    /// \a self until all the indices are done.
+    void work(size_t self, const std::function<void (size_t)>& body)
+    {
+        Range r;
+        while (_left.load(std::memory_order_acquire) != 0)
+        {
+            if (!popOwn(self, r) && !steal(self, r))
+            {
+                waitForRanges();
+                continue;
+            }
+
+            // keep the lower half, share the upper one
+            while (r.last - r.first > 1)
+            {
+                size_t mid = r.first + (r.last - r.first) / 2;
+                share(self, {mid, r.last});
+                r.last = mid;
+            }
+
+            body(r.first);
+            if (_left.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                // the job is done, the sleeping threads are to return
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                }
+                _more.notify_all();
+            }
+        }
+    }
+
+    /// Sleeps until some deque has a range or the job is done.
+    void waitForRanges()
+    {
+        // a sharing thread sees either the ranges counted here or this
+        // thread idle, so it cannot miss waking it
+        std::unique_lock<std::mutex> lock(_mutex);
+        ++_idleNum;
+        _more.wait(lock, [this]()
+                   { return _queuedNum != 0
+                            || _left.load(std::memory_order_acquire) == 0; });
+        --_idleNum;
+    }
+
+    /// Pushes the range \a r to the deque of the thread \a self and wakes
+    /// an idle thread, if any, to steal it.
+    void share(size_t self, Range r)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_queues[self].mutex);
+            _queues[self].ranges.push_back(r);
+            ++_queuedNum;
+        }
+
+        if (_idleNum != 0)
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+            }
+            _more.notify_one();
+        }
+    }
+
+    /// Takes the newest range of the thread \a self.
+    bool popOwn(size_t self, Range& r)
+    {
+        Queue& q = _queues[self];
+        std::lock_guard<std::mutex> lock(q.mutex);
+        if (q.ranges.empty())
+            return false;
+
+        r = q.ranges.back();
+        q.ranges.pop_back();
+        --_queuedNum;
+        return true;
+    }
+
+    /// Takes the oldest range of a thread other than \a self.
+    bool steal(size_t self, Range& r)
+    {
+        for (size_t k = 1; k < _queues.size(); ++k)
+        {
+            Queue& q = _queues[(self + k) % _queues.size()];
+            std::lock_guard<std::mutex> lock(q.mutex);
+            if (!q.ranges.empty())
+            {
+                r = q.ranges.front();
+                q.ranges.pop_front();
+                --_queuedNum;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+protected:
+    std::vector<Queue> _queues;         ///< Deques of ranges per thread.
+    std::vector<std::thread> _threads;  ///< Background threads.
+
+    std::mutex _jobMutex;               ///< Serializes jobs.
+    std::mutex _mutex;                  ///< Guards the job state below.
+    std::condition_variable _wake;      ///< Signals a new job or stop.
+    std::condition_variable _done;      ///< Signals a thread gone idle.
+    std::condition_variable _more;      ///< Signals a shared range or the end.
+
+    const std::function<void (size_t)>* _body;  ///< Body of the current job.
+    std::uint64_t _jobId;               ///< Number of the current job.
+    std::atomic<size_t> _left;          ///< Indices not done yet.
+    std::atomic<size_t> _queuedNum;     ///< Ranges in all the deques.
+    std::atomic<size_t> _idleNum;       ///< Threads waiting for ranges.
+    size_t _busyNum;                    ///< Threads working on the job.
+    bool _stop;                         ///< Pool is being destroyed.
+}; // class WorkStealingPool
+
+
+
+#endif // THREAD_POOL_HPP_
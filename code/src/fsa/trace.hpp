@@ -0,0 +1,275 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains declarations of the types for tracing replays.
+/// \author     DFA library contributors
+/// \version    0.1.0
+/// \date       16.10.2026
+/// \copyright  © DFA library contributors 2026.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TRACE_HPP_
+#define TRACE_HPP_
+
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "compiled_dfa.hpp"
+
+
+
+/// Compact record of a fired transition of a compiled DFA.
+template<typename Alpha>
+struct TraceRecord {
+    std::uint64_t pos;                  ///< Position of the symbol.
+    InternId from;                      ///< Index of the source state.
+    InternId to;                        ///< Index of the destination state.
+    Alpha symbol;                       ///< Symbol activating the transition.
+}; // struct TraceRecord
+
+
+/*! ****************************************************************************
+ *  \brief SpscRing is a bounded lock-free queue for a single producer thread
+ *  and a single consumer thread.
+ *
+ *  The capacity is rounded up to a power of two. Each side keeps a cached copy
+ *  of the other side's index and reloads it only when the ring looks full
+ *  (empty), so a push or a pop usually touches no shared cache line but
+ *  the slots.
+ *
+ *  \tparam T is a type of elements, trivially copyable.
+ ******************************************************************************/
+template<typename T>
+class SpscRing {
+public:
+    typedef T TValue;
+
+public:
+    // Constructors and all.
+
+    /// Makes a ring of at least \a capacity elements.
+    explicit SpscRing(size_t capacity)
+        : _head(0)
+        , _tailCache(0)
+        , _tail(0)
+        , _headCache(0)
+    {
+        size_t cap = 1;
+        while (cap < capacity)
+            cap *= 2;
+        _slots.resize(cap);
+        _mask = cap - 1;
+    }
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+public:
+
+    /// \return number of elements the ring can hold.
+    size_t capacity() const { return _slots.size(); }
+
+    /// Appends \a v to the ring; called by the producer only.
+    /// \return false if the ring is full, so \a v is not appended.
+    bool tryPush(const T& v)
+    {
+        const size_t head = _head.load(std::memory_order_relaxed);
+        if (head - _tailCache == _slots.size())
+        {
+            _tailCache = _tail.load(std::memory_order_acquire);
+            if (head - _tailCache == _slots.size())
+                return false;
+        }
+
+        _slots[head & _mask] = v;
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Takes at most \a maxNum elements off the ring to \a out; called by
+    /// the consumer only.
+    /// \return number of elements taken.
+    size_t pop(T* out, size_t maxNum)
+    {
+        const size_t tail = _tail.load(std::memory_order_relaxed);
+        if (_headCache == tail)
+        {
+            _headCache = _head.load(std::memory_order_acquire);
+            if (_headCache == tail)
+                return 0;
+        }
+
+        size_t n = std::min(maxNum, _headCache - tail);
+        for (size_t i = 0; i < n; ++i)
+            out[i] = _slots[(tail + i) & _mask];
+        _tail.store(tail + n, std::memory_order_release);
+
+        return n;
+    }
+
+protected:
+    /// Size of a cache line, to keep the sides apart.
+    static constexpr size_t CacheLine = 64;
+
+protected:
+    std::vector<T> _slots;              ///< Elements.
+    size_t _mask;                       ///< Capacity minus one.
+
+    // producer side
+    alignas(CacheLine) std::atomic<size_t> _head;   ///< Count of pushed.
+    size_t _tailCache;                  ///< Last seen count of popped.
+
+    // consumer side
+    alignas(CacheLine) std::atomic<size_t> _tail;   ///< Count of popped.
+    size_t _headCache;                  ///< Last seen count of pushed.
+}; // class SpscRing
+
+
+/*! ****************************************************************************
+ *  \brief Listener policy for BasicCompiledDfaPlayer that writes a TraceRecord
+ *  of every fired transition to a SpscRing.
+ *
+ *  The player never blocks: if the ring is full, a record is dropped and
+ *  counted, see getDroppedNum().
+ *
+ *  \tparam Alpha represent elements of the alphabet of an automaton.
+ ******************************************************************************/
+template<typename Alpha>
+class TraceListener {
+public:
+    /// Record written to the ring.
+    typedef TraceRecord<Alpha> Record;
+
+    /// Ring the records are written to.
+    typedef SpscRing<Record> Ring;
+
+public:
+    /// Makes a listener writing to the \a ring.
+    explicit TraceListener(Ring& ring)
+        : _ring(&ring)
+        , _droppedNum(0)
+    {
+    }
+
+    void onStateChanging(InternId /*preS*/, InternId /*newS*/) {}
+
+    void onTransFired(std::uint64_t pos, InternId s, Alpha a, InternId /*c*/,
+                      InternId d)
+    {
+        if (!_ring->tryPush(Record{pos, s, d, a}))
+            ++_droppedNum;
+    }
+
+    void onNoTrans(std::uint64_t /*pos*/, InternId /*s*/, Alpha /*a*/) {}
+
+    /// \return number of records dropped because of overflow.
+    std::uint64_t getDroppedNum() const { return _droppedNum; }
+
+    /// \return true if some records have been dropped.
+    bool isOverflowed() const { return _droppedNum != 0; }
+
+    /// Resets the counter of dropped records.
+    void resetDropped() { _droppedNum = 0; }
+
+protected:
+    Ring* _ring;                        ///< Ring of records.
+    std::uint64_t _droppedNum;          ///< Number of dropped records.
+}; // class TraceListener
+
+
+/*! ****************************************************************************
+ *  \brief TraceConsumer drains a SpscRing of trace records in a thread of its
+ *  own and delivers them by batches to a sink, a callable
+ *  `sink(const TraceRecord<Alpha>* recs, size_t n)`.
+ *
+ *  \tparam Alpha represent elements of the alphabet of an automaton.
+ ******************************************************************************/
+template<typename Alpha>
+class TraceConsumer {
+public:
+    /// Record taken off the ring.
+    typedef TraceRecord<Alpha> Record;
+
+    /// Ring the records are taken off.
+    typedef SpscRing<Record> Ring;
+
+    /// Sink of batches of records.
+    typedef std::function<void (const Record*, size_t)> Sink;
+
+    /// Number of records delivered to a sink at once (at most).
+    static constexpr size_t BatchSize = 256;
+
+public:
+    // Constructors and all.
+
+    /// Starts draining the \a ring into the \a sink.
+    TraceConsumer(Ring& ring, Sink sink)
+        : _ring(ring)
+        , _sink(std::move(sink))
+        , _stop(false)
+    {
+        _thread = std::thread([this]() { run(); });
+    }
+
+    TraceConsumer(const TraceConsumer&) = delete;
+    TraceConsumer& operator=(const TraceConsumer&) = delete;
+
+    ~TraceConsumer() { stop(); }
+
+public:
+
+    /// Drains the records pushed so far and stops the thread.
+    void stop()
+    {
+        if (!_thread.joinable())
+            return;
+
+        _stop.store(true, std::memory_order_release);
+        _thread.join();
+    }
+
+protected:
+    void run()
+    {
+        Record batch[BatchSize];
+        for (;;)
+        {
+            // the flag is read before draining, so nothing pushed before
+            // stop() is left behind
+            bool stopping = _stop.load(std::memory_order_acquire);
+            size_t n = _ring.pop(batch, BatchSize);
+            if (n != 0)
+                _sink(static_cast<const Record*>(batch), n);
+            else if (stopping)
+                return;
+            else
+                std::this_thread::yield();
+        }
+    }
+
+protected:
+    Ring& _ring;                        ///< Ring of records.
+    Sink _sink;                         ///< Sink of batches.
+    std::atomic<bool> _stop;            ///< Request to stop.
+    std::thread _thread;                ///< Draining thread.
+}; // class TraceConsumer
+
+
+template<typename Alpha>
+constexpr size_t TraceConsumer<Alpha>::BatchSize;
+
+
+
+#endif // TRACE_HPP_
@@ -0,0 +1,131 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for AccelDfa class.
+///
+/// © DFA library contributors 2026.
+///
+/// This code is for educational purposes of the course "Algorithms and Data 
+/// Structures" provided by the School of Software Engineering of the Faculty 
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "fsa/auto_dfa.hpp"
+#include "fsa/regex.hpp"
+#include "same_as_dfa_player.hpp"
+
+
+typedef Dfa<int, char> IntCharDfa;
+typedef CompiledDfa<int, char> IntCharCompiledDfa;
+typedef AccelDfa<int, char> IntCharAccelDfa;
+typedef AccelDfaPlayer<int, char> IntCharAccelDfaPlayer;
+
+
+/// Checks replays of random sequences of runs of \a runs by \a player against
+/// the reference DfaPlayer.
+template<typename Player>
+static void expectAccelSameAsDfaPlayer(const IntCharDfa& dfa, Player& player,
+                                       const std::vector<std::string>& runs)
+{
+    std::mt19937 rnd(29);
+    std::vector<std::string> strs(500);
+    for (std::string& s : strs)
+    {
+        size_t n = rnd() % 20;
+        for (size_t j = 0; j < n; ++j)
+        {
+            const std::string& run = runs[rnd() % runs.size()];
+            s += run.substr(0, rnd() % (run.size() + 1));
+        }
+    }
+
+    expectSameAsDfaPlayer(dfa, player, strs);
+}
+
+
+TEST(AccelDfa, comments)
+{
+    // lines of words and comments running up to the end of a line
+    IntCharDfa dfa = RegexCompiler::compile("([a-z ]*(#.*)?\n)*");
+    IntCharCompiledDfa cdfa(dfa);
+    IntCharAccelDfa adfa(cdfa);
+    ASSERT_EQ(1, adfa.getAccelStatesNum());
+    EXPECT_EQ(1, adfa.getScanStatesNum());
+    EXPECT_TRUE(IntCharAccelDfa::isApplicable(cdfa));
+
+    IntCharCompiledDfa::Index s = 0;
+    while (!adfa.isAccel(s))
+        ++s;
+    ASSERT_EQ(1, adfa.getExitsNum(s));
+    EXPECT_EQ('\n', adfa.getExits(s)[0]);
+
+    std::vector<std::string> runs = {
+        "abc def ", "\n", "# a very long comment, with 1 2 3 and ###\n",
+        std::string(100, 'x') + "#" + std::string(300, '-') + "\n", "A"
+    };
+    IntCharAccelDfaPlayer player(adfa);
+    expectAccelSameAsDfaPlayer(dfa, player, runs);
+
+    // Sheng takes precedence over scans
+    AutoDfa<int, char> sheng(cdfa);
+    if (isSimdSupported(SimdLevel::Ssse3))
+    {
+        EXPECT_EQ(DfaEngine::Sheng, sheng.getEngine());
+    }
+
+    AutoDfa<int, char> autoDfa(cdfa, SimdLevel::None);
+    EXPECT_EQ(DfaEngine::Accel, autoDfa.getEngine());
+    AutoDfaPlayer<int, char> aplayer(autoDfa);
+    expectAccelSameAsDfaPlayer(dfa, aplayer, runs);
+}
+
+TEST(AccelDfa, severalExits)
+{
+    // quoted strings with escapes, exits of the string state are ", \ and \n
+    IntCharDfa dfa = RegexCompiler::compile("(\"([^\"\\\\\n]|\\\\.)*\" *)*");
+    IntCharCompiledDfa cdfa(dfa);
+    IntCharAccelDfa adfa(cdfa);
+    ASSERT_EQ(1, adfa.getAccelStatesNum());
+
+    std::vector<std::string> runs = {
+        "\"", "\\\"", "\\\\", "\n", "   ",
+        "a quoted string of more than sixteen bytes, to be scanned",
+    };
+    IntCharAccelDfaPlayer player(adfa);
+    expectAccelSameAsDfaPlayer(dfa, player, runs);
+}
+
+TEST(AccelDfa, noExits)
+{
+    // any sequence starting with 'x' is accepted
+    IntCharDfa dfa;
+    dfa.addTrans(0, 'x', 1);
+    for (int a = -128; a < 128; ++a)
+        dfa.addTrans(1, char(a), 1);
+    dfa.setInitState(0);
+    dfa.addFinState(1);
+    IntCharCompiledDfa cdfa(dfa);
+    IntCharAccelDfa adfa(cdfa);
+    EXPECT_EQ(1, adfa.getAccelStatesNum());
+    EXPECT_EQ(0, adfa.getScanStatesNum());
+    EXPECT_FALSE(adfa.isAccel(0));
+
+    std::vector<std::string> runs = { "x", "xyz", "\n\n\n", "yx" };
+    IntCharAccelDfaPlayer player(adfa);
+    expectAccelSameAsDfaPlayer(dfa, player, runs);
+
+    // a sink alone is no reason for scans, the table stops in it
+    AutoDfa<int, char> autoDfa(cdfa, SimdLevel::None);
+    EXPECT_EQ(DfaEngine::Table, autoDfa.getEngine());
+    ASSERT_NE(nullptr, autoDfa.getFates());
+    AutoDfaPlayer<int, char> aplayer(autoDfa);
+    expectAccelSameAsDfaPlayer(dfa, aplayer, runs);
+}
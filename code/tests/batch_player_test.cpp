@@ -0,0 +1,71 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for BatchDfaPlayer class.
+///
+/// © DFA library contributors 2026.
+///
+/// This code is for educational purposes of the course "Algorithms and Data 
+/// Structures" provided by the School of Software Engineering of the Faculty 
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "fsa/batch_player.hpp"
+#include "fsa/regex.hpp"
+
+
+typedef SharedDfa<int, char> IntCharSharedDfa;
+typedef BatchDfaPlayer<int, char> IntCharBatchDfaPlayer;
+
+
+TEST(BatchDfaPlayer, sameAsPlayer)
+{
+    IntCharSharedDfa dfa(RegexCompiler::compile("(a|b)*abb(c*|a)"));
+
+    // mostly short sequences and a few long ones
+    std::mt19937 rnd(11);
+    std::vector<std::string> strs(5000);
+    for (std::string& s : strs)
+    {
+        size_t len = (rnd() % 100 == 0) ? 50000 + rnd() % 50000 : rnd() % 30;
+        for (size_t i = 0; i < len; ++i)
+            s += "abbc"[rnd() % 4];
+        if (rnd() % 3 == 0)
+            s += "abb";
+    }
+    std::vector<std::string_view> seqs(strs.begin(), strs.end());
+
+    std::vector<PlayResult> expected;
+    SharedDfaPlayer<int, char> player(dfa);
+    for (std::string_view seq : seqs)
+        expected.push_back(player.play(seq));
+
+    for (size_t threadsNum : {1, 3, 8})
+    {
+        WorkStealingPool pool(threadsNum);
+        for (size_t grain : {1, 100, 1 << 14})
+        {
+            IntCharBatchDfaPlayer batch(dfa, pool, grain);
+            EXPECT_EQ(expected, batch.playBatch(seqs));
+
+            // to the caller's array, twice with the same player
+            std::vector<PlayResult> results(seqs.size(), PlayResult::Ok);
+            batch.playBatch(seqs.data(), seqs.size(), results.data());
+            batch.playBatch(seqs.data(), seqs.size(), results.data());
+            EXPECT_EQ(expected, results);
+        }
+    }
+
+    WorkStealingPool pool(2);
+    IntCharBatchDfaPlayer batch(dfa, pool);
+    EXPECT_TRUE(batch.playBatch(std::vector<std::string_view>()).empty());
+}
@@ -0,0 +1,327 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for CompiledDfa classes.
+///
+/// © DFA library contributors 2026.
+///
+/// This code is for educational purposes of the course "Algorithms and Data 
+/// Structures" provided by the School of Software Engineering of the Faculty 
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "fsa/compiled_dfa.hpp"
+
+
+typedef Dfa<int, char> IntCharDfa;
+typedef DfaPlayer<int, char> IntCharDfaPlayer;
+typedef CompiledDfa<int, char> IntCharCompiledDfa;
+typedef CompiledDfaPlayer<int, char> IntCharCompiledDfaPlayer;
+
+
+TEST(CompiledDfa, makeExample1)
+{
+    IntCharDfa dfa{0,                           // init state
+                   { {0, '1', 0}, {0, '0', 1},  // trans table
+                     {1, '0', 1}, {1, '1', 2},
+                     {2, '0', 2}, {2, '1', 2}
+                   },
+                   { 2 }                        // fin states
+                  };
+    IntCharCompiledDfa cdfa(dfa);
+
+    EXPECT_EQ(3, cdfa.getStatesNum());
+    EXPECT_EQ(2, cdfa.getSymbolsNum());
+    EXPECT_EQ(2, cdfa.getClassesNum());
+    EXPECT_EQ(0, cdfa.getState(cdfa.getInitIndex()));
+
+    IntCharCompiledDfa::Index s, c;
+    EXPECT_TRUE(cdfa.getStateIndex(1, s));
+    EXPECT_TRUE(cdfa.getSymbolClass('1', c));
+    EXPECT_EQ(2, cdfa.getState(cdfa.getTransIndex(s, c)));
+    EXPECT_FALSE(cdfa.getSymbolClass('x', c));
+    EXPECT_FALSE(cdfa.isFinIndex(s));
+}
+
+TEST(CompiledDfa, noTrans)
+{
+    IntCharDfa dfa{0, { {0, 'a', 1}, {1, 'b', 0} }, { 1 }};
+    IntCharCompiledDfa cdfa(dfa);
+
+    IntCharCompiledDfa::Index s, c;
+    EXPECT_TRUE(cdfa.getStateIndex(0, s));
+    EXPECT_TRUE(cdfa.getSymbolClass('b', c));
+    EXPECT_TRUE(cdfa.getTransIndex(s, c) == IntCharCompiledDfa::NoTrans);
+}
+
+TEST(CompiledDfa, symbolClasses)
+{
+    // identifiers: a letter followed by letters or digits
+    IntCharDfa dfa;
+    for (char a = 'a'; a <= 'z'; ++a)
+    {
+        dfa.addTrans(0, a, 1);
+        dfa.addTrans(1, a, 1);
+    }
+    for (char a = '0'; a <= '9'; ++a)
+        dfa.addTrans(1, a, 1);
+    dfa.addTrans(1, '_', 1);
+    dfa.addFinState(1);
+    IntCharCompiledDfa cdfa(dfa);
+
+    EXPECT_EQ(37, cdfa.getSymbolsNum());
+    EXPECT_EQ(2, cdfa.getClassesNum());
+
+    IntCharCompiledDfa::Index c1, c2;
+    EXPECT_TRUE(cdfa.getSymbolClass('a', c1));
+    EXPECT_TRUE(cdfa.getSymbolClass('q', c2));
+    EXPECT_EQ(c1, c2);
+    EXPECT_TRUE(cdfa.getSymbolClass('7', c1));
+    EXPECT_TRUE(cdfa.getSymbolClass('_', c2));
+    EXPECT_EQ(c1, c2);
+    EXPECT_TRUE(cdfa.getSymbolClass('a', c2));
+    EXPECT_NE(c1, c2);
+
+    IntCharCompiledDfaPlayer player(cdfa);
+    EXPECT_EQ(IntCharDfaPlayer::Result::Ok, player.play({'x', '1', '_'}));
+    EXPECT_EQ(IntCharDfaPlayer::Result::NoTrans, player.play({'1', 'x'}));
+    EXPECT_EQ(0, player.getCurPos());
+}
+
+TEST(CompiledDfaPlayer, replay1)
+{
+    IntCharDfa dfa{0,                           // init state
+                   { {0, '1', 0}, {0, '0', 1},  // trans table
+                     {1, '0', 1}, {1, '1', 2},
+                     {2, '0', 2}, {2, '1', 2}
+                   },
+                   { 2 }                        // fin states
+                  };
+    IntCharCompiledDfa cdfa(dfa);
+    IntCharCompiledDfaPlayer player(cdfa);
+    EXPECT_EQ(IntCharDfaPlayer::Result::Ok, player.play({'0', '1'}));
+    EXPECT_EQ(IntCharDfaPlayer::Result::Ok, player.play({'0', '0', '1'}));
+    EXPECT_EQ(IntCharDfaPlayer::Result::Ok, player.play({'1', '0', '1', '0'}));
+
+    EXPECT_EQ(IntCharDfaPlayer::Result::NonFinState, player.play({'1', '0', '0'}));
+    EXPECT_EQ(3, player.getCurPos());
+    EXPECT_EQ(1, player.getCurState());
+    EXPECT_EQ('0', player.getLastSymbol());
+
+    EXPECT_EQ(IntCharDfaPlayer::Result::NoTrans, player.play({'1', '0', 'x', '0'}));
+    EXPECT_EQ(2, player.getCurPos());
+    EXPECT_EQ(1, player.getCurState());
+    EXPECT_EQ('x', player.getLastSymbol());
+}
+
+TEST(CompiledDfaPlayer, sameAsDfaPlayer)
+{
+    IntCharDfa dfa{0, { {0, 'a', 1}, {1, 'b', 0}, {1, 'c', 2} }, { 2 }};
+    IntCharCompiledDfa cdfa(dfa);
+    IntCharDfaPlayer ref(dfa);
+    IntCharCompiledDfaPlayer player(cdfa);
+
+    std::vector<std::vector<char>> seqs = {
+        {}, {'a'}, {'a', 'c'}, {'a', 'b', 'a', 'c'}, {'a', 'c', 'a'},
+        {'b'}, {'a', 'b', 'b'}
+    };
+    for (const std::vector<char>& seq : seqs)
+    {
+        EXPECT_EQ(ref.play(seq), player.play(seq));
+        EXPECT_EQ(ref.getCurPos(), player.getCurPos());
+        EXPECT_EQ(ref.getCurState(), player.getCurState());
+    }
+}
+
+TEST(CompiledDfaPlayer, stringStates)
+{
+    Dfa<std::string, std::uint64_t> dfa{"start",
+                                        { {"start", 1ull << 40, "mid"},
+                                          {"mid", 2, "end"} },
+                                        { "end" }};
+    CompiledDfa<std::string, std::uint64_t> cdfa(dfa);
+    typedef CompiledDfaPlayer<std::string, std::uint64_t> StrU64Player;
+    StrU64Player player(cdfa);
+
+    EXPECT_EQ(StrU64Player::Result::Ok, player.play({1ull << 40, 2}));
+    EXPECT_EQ("end", player.getCurState());
+    EXPECT_EQ(StrU64Player::Result::NoTrans, player.play({2}));
+    EXPECT_EQ("start", player.getCurState());
+}
+
+TEST(CompiledDfaPlayer, boolSymbols)
+{
+    // words of bits with an odd number of ones
+    Dfa<int, bool> dfa{0, { {0, false, 0}, {0, true, 1},
+                            {1, false, 1}, {1, true, 0} }, { 1 }};
+    CompiledDfa<int, bool> cdfa(dfa);
+    EXPECT_EQ(2, cdfa.getSymbolsNum());
+    CompiledDfa<int, bool> copy = cdfa;
+
+    typedef CompiledDfaPlayer<int, bool> IntBoolPlayer;
+    DfaPlayer<int, bool> ref(dfa);
+    IntBoolPlayer player(copy);
+    const bool bits[] = { true, false, true, true, false };
+    for (size_t len = 0; len <= sizeof(bits); ++len)
+    {
+        EXPECT_EQ(ref.play(bits, len), player.play(bits, len));
+        EXPECT_EQ(ref.getCurState(), player.getCurState());
+        EXPECT_EQ(ref.getCurPos(), player.getCurPos());
+    }
+    EXPECT_EQ(IntBoolPlayer::Result::Ok, player.play(bits, 4));
+    EXPECT_EQ(1, player.getCurState());
+}
+
+TEST(CompiledDfaPlayer, replayNoCopy)
+{
+    IntCharDfa dfa{0, { {0, 'a', 1}, {1, 'b', 0} }, { 1 }};
+    IntCharCompiledDfa cdfa(dfa);
+    IntCharCompiledDfaPlayer player(cdfa);
+
+    const char* buf = "ababa";
+    EXPECT_EQ(IntCharDfaPlayer::Result::Ok, player.play(buf, 5));
+    EXPECT_EQ(IntCharDfaPlayer::Result::NonFinState, player.play(buf, buf + 4));
+    EXPECT_EQ(IntCharDfaPlayer::Result::NoTrans, player.play(std::string_view("abb")));
+    EXPECT_EQ(2, player.getCurPos());
+}
+
+TEST(CompiledDfaPlayer, replayByChunks)
+{
+    IntCharDfa dfa{0, { {0, 'a', 1}, {1, 'b', 0} }, { 1 }};
+    IntCharCompiledDfa cdfa(dfa);
+    IntCharCompiledDfaPlayer player(cdfa);
+    IntCharDfaPlayer ref(dfa);
+
+    const std::string seq = "abababababa";
+    for (size_t chunk = 1; chunk <= seq.size(); ++chunk)
+    {
+        player.begin();
+        for (size_t i = 0; i < seq.size(); i += chunk)
+            player.feed(seq.data() + i, std::min(chunk, seq.size() - i));
+        EXPECT_EQ(ref.play(std::string_view(seq)), player.finish());
+        EXPECT_EQ(seq.size(), player.getCurPos());
+    }
+}
+
+/// Listener policy recording slots of fired transitions.
+struct SlotListener {
+    const IntCharCompiledDfa* dfa;
+    std::vector<std::uint64_t> positions;
+    std::vector<size_t> slots;
+
+    explicit SlotListener(const IntCharCompiledDfa* d) : dfa(d) {}
+
+    void onStateChanging(IntCharCompiledDfa::Index, IntCharCompiledDfa::Index)
+    {
+        positions.clear();
+        slots.clear();
+    }
+
+    void onTransFired(std::uint64_t pos, IntCharCompiledDfa::Index s, char /*a*/,
+                      IntCharCompiledDfa::Index c, IntCharCompiledDfa::Index d)
+    {
+        EXPECT_EQ(d, dfa->getTransIndex(s, c));
+        positions.push_back(pos);
+        slots.push_back(s * dfa->getClassesNum() + c);
+    }
+
+    void onNoTrans(std::uint64_t pos, IntCharCompiledDfa::Index, char)
+    {
+        EXPECT_EQ(positions.size(), pos);
+    }
+}; // struct SlotListener
+
+TEST(BasicCompiledDfaPlayer, staticListener)
+{
+    IntCharDfa dfa{0, { {0, 'a', 1}, {1, 'b', 0}, {1, 'c', 2} }, { 2 }};
+    IntCharCompiledDfa cdfa(dfa);
+
+    BasicCompiledDfaPlayer<int, char, SlotListener> player(cdfa,
+                                                           SlotListener(&cdfa));
+    EXPECT_EQ(PlayResult::Ok, player.play(std::string_view("abac")));
+    EXPECT_EQ((std::vector<std::uint64_t>{0, 1, 2, 3}),
+              player.getListener().positions);
+    const std::vector<size_t>& slots = player.getListener().slots;
+    ASSERT_EQ(4, slots.size());
+    EXPECT_EQ(slots[0], slots[2]);
+    EXPECT_NE(slots[1], slots[3]);
+
+    EXPECT_EQ(PlayResult::NoTrans, player.play(std::string_view("ab b")));
+    EXPECT_EQ(2, player.getListener().slots.size());
+    EXPECT_EQ(0, player.getCurState());
+
+    // a null listener leaves the semantics as is
+    BasicCompiledDfaPlayer<int, char, NullListener> bare(cdfa);
+    IntCharCompiledDfaPlayer ref(cdfa);
+    for (const char* seq : {"", "a", "ac", "abac", "aca", "b", "abb"})
+    {
+        EXPECT_EQ(ref.play(std::string_view(seq)),
+                  bare.play(std::string_view(seq)));
+        EXPECT_EQ(ref.getCurPos(), bare.getCurPos());
+        EXPECT_EQ(ref.getCurState(), bare.getCurState());
+        EXPECT_EQ(ref.getLastSymbol(), bare.getLastSymbol());
+    }
+
+    // an empty replay keeps nothing of the previous one
+    EXPECT_EQ(PlayResult::NoTrans, bare.play(std::string_view("abb")));
+    EXPECT_EQ(PlayResult::NonFinState, bare.play(std::string_view("")));
+    EXPECT_EQ(0, bare.getCurPos());
+    EXPECT_EQ('\0', bare.getLastSymbol());
+}
+
+TEST(CompiledDfaPlayer, stopsOnFates)
+{
+    const std::string abc = "ab";
+    std::srand(25);
+    for (int iter = 0; iter < 50; ++iter)
+    {
+        // complete automata whose last states are sinks
+        int n = 2 + std::rand() % 20;
+        IntCharDfa dfa;
+        dfa.addState(0);
+        for (int q = 0; q < n; ++q)
+        {
+            for (char a : abc)
+                dfa.addTrans(q, a, q + 2 < n ? std::rand() % n : q);
+            if (std::rand() % 3 == 0)
+                dfa.addFinState(q);
+        }
+        if (iter % 5 == 0)
+            dfa.addTrans(std::rand() % n, 'c', 0);
+
+        IntCharCompiledDfa cdfa(dfa);
+        IntCharCompiledDfa::Fates fates = cdfa.getFates(true);
+        ASSERT_EQ(cdfa.getStatesNum(), fates.size());
+        IntCharDfa::Fates mapFates = dfa.getFates(true);
+        for (IntCharCompiledDfa::Index s = 0; s < fates.size(); ++s)
+        {
+            auto it = mapFates.find(cdfa.getState(s));
+            EXPECT_EQ(it == mapFates.end() ? StateFate::Open : it->second,
+                      fates[s]);
+        }
+
+        BasicCompiledDfaPlayer<int, char, NullListener> ref(cdfa), player(cdfa);
+        player.setFates(&fates);
+        for (int w = 0; w < 50; ++w)
+        {
+            std::string seq(std::rand() % 40, 0);
+            for (char& a : seq)
+                a = abc[std::rand() % abc.size()];
+            EXPECT_EQ(ref.play(std::string_view(seq)),
+                      player.play(std::string_view(seq)));
+            EXPECT_EQ(ref.getCurPos(), player.getCurPos());
+            EXPECT_EQ(ref.getLastSymbol(), player.getLastSymbol());
+            EXPECT_EQ(fates[ref.getCurIndex()],
+                      fates[player.getCurIndex()]);
+        }
+    }
+}
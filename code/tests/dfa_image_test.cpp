@@ -0,0 +1,173 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for DfaImage class.
+///
+/// © DFA library contributors 2026.
+///
+/// This code is for educational purposes of the course "Algorithms and Data 
+/// Structures" provided by the School of Software Engineering of the Faculty 
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "fsa/dfa_image.hpp"
+#include "fsa/regex.hpp"
+
+
+typedef Dfa<int, char> IntCharDfa;
+typedef CompiledDfa<int, char> IntCharCompiledDfa;
+typedef CompiledDfaPlayer<int, char> IntCharCompiledDfaPlayer;
+typedef DfaImage<int, char> IntCharDfaImage;
+
+
+TEST(DfaImage, saveLoad)
+{
+    std::string path = testing::TempDir() + "dfa_image_test.bin";
+    IntCharDfa dfa = RegexCompiler::compile("[a-z_][a-z0-9_]*(\\.[a-z_]+)*");
+    IntCharCompiledDfa cdfa(dfa);
+    IntCharDfaImage::save(cdfa, path);
+
+    IntCharCompiledDfa ldfa = IntCharDfaImage::load(path);
+    EXPECT_EQ(cdfa.getStatesNum(), ldfa.getStatesNum());
+    EXPECT_EQ(cdfa.getSymbolsNum(), ldfa.getSymbolsNum());
+    EXPECT_EQ(cdfa.getClassesNum(), ldfa.getClassesNum());
+    EXPECT_EQ(cdfa.getInitIndex(), ldfa.getInitIndex());
+
+    for (IntCharCompiledDfa::Index s = 0; s < cdfa.getStatesNum(); ++s)
+    {
+        EXPECT_EQ(cdfa.getState(s), ldfa.getState(s));
+        EXPECT_EQ(cdfa.isFinIndex(s), ldfa.isFinIndex(s));
+        for (IntCharCompiledDfa::Index c = 0; c < cdfa.getClassesNum(); ++c)
+            EXPECT_EQ(cdfa.getTransIndex(s, c), ldfa.getTransIndex(s, c));
+    }
+    for (int a = -128; a < 128; ++a)
+    {
+        IntCharCompiledDfa::Index c1, c2;
+        EXPECT_EQ(cdfa.getSymbolClass(char(a), c1),
+                  ldfa.getSymbolClass(char(a), c2));
+        EXPECT_EQ(c1, c2);
+    }
+
+    // the loaded automaton and its copies stay valid after the file is gone
+    std::remove(path.c_str());
+    IntCharCompiledDfa copy = ldfa;
+    IntCharCompiledDfaPlayer player(copy);
+    EXPECT_EQ(IntCharCompiledDfaPlayer::Result::Ok,
+              player.play(std::string_view("os.path_join")));
+    EXPECT_EQ(IntCharCompiledDfaPlayer::Result::NonFinState,
+              player.play(std::string_view("os.")));
+    EXPECT_EQ(IntCharCompiledDfaPlayer::Result::NoTrans,
+              player.play(std::string_view("9lives")));
+    EXPECT_EQ(0, player.getCurPos());
+}
+
+TEST(DfaImage, manyStates)
+{
+    // more than 64 states fill several words of the accept bitset
+    IntCharDfa dfa;
+    for (int s = 0; s < 200; ++s)
+    {
+        dfa.addTrans(s, 'a', (s + 1) % 200);
+        if (s % 3 == 0)
+            dfa.addFinState(s);
+    }
+    dfa.setInitState(0);
+
+    std::string path = testing::TempDir() + "dfa_image_test.bin";
+    IntCharDfaImage::save(IntCharCompiledDfa(dfa), path);
+    IntCharCompiledDfa ldfa = IntCharDfaImage::load(path);
+    std::remove(path.c_str());
+
+    IntCharCompiledDfaPlayer player(ldfa);
+    for (size_t n = 0; n < 400; ++n)
+    {
+        std::string seq(n, 'a');
+        EXPECT_EQ(n % 200 % 3 == 0, player.play(std::string_view(seq))
+                  == IntCharCompiledDfaPlayer::Result::Ok);
+    }
+}
+
+TEST(DfaImage, rejectBadImages)
+{
+    std::string path = testing::TempDir() + "dfa_image_test.bin";
+    IntCharDfaImage::save(IntCharCompiledDfa(RegexCompiler::compile("a+b")),
+                          path);
+
+    std::vector<char> img;
+    {
+        std::ifstream in(path, std::ios::binary);
+        img.assign(std::istreambuf_iterator<char>(in),
+                   std::istreambuf_iterator<char>());
+    }
+    auto rewrite = [&path](const std::vector<char>& bytes)
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), std::streamsize(bytes.size()));
+    };
+
+    // a flipped bit in the table is caught by the checksum only
+    std::vector<char> bad = img;
+    bad[bad.size() - 1] ^= 1;
+    rewrite(bad);
+    EXPECT_THROW(IntCharDfaImage::load(path), DfaImageError);
+    EXPECT_NO_THROW(IntCharDfaImage::load(path, false));
+
+    bad = img;
+    bad[0] = 'X';
+    rewrite(bad);
+    EXPECT_THROW(IntCharDfaImage::load(path), DfaImageError);
+
+    bad.assign(img.begin(), img.end() - 8);
+    rewrite(bad);
+    EXPECT_THROW(IntCharDfaImage::load(path), DfaImageError);
+
+    rewrite(std::vector<char>());
+    EXPECT_THROW(IntCharDfaImage::load(path), DfaImageError);
+
+    // entries out of range are caught even without the checksum
+    typedef IntCharCompiledDfa::Index Index;
+    IntCharDfaImage::Header h;
+    std::memcpy(&h, img.data(), sizeof(h));
+    bad = img;
+    Index state = Index(h.statesNum);
+    std::memcpy(&bad[h.tableOff], &state, sizeof(state));
+    rewrite(bad);
+    EXPECT_THROW(IntCharDfaImage::load(path, false), DfaImageError);
+
+    bad = img;
+    Index cls = Index(h.classesNum);
+    std::memcpy(&bad[h.classesOff + 'a' * sizeof(Index)], &cls, sizeof(cls));
+    rewrite(bad);
+    EXPECT_THROW(IntCharDfaImage::load(path, false), DfaImageError);
+
+    // so are sizes that do not fit indices or overflow
+    for (std::uint64_t statesNum : {std::uint64_t(NoInternId),
+                                    std::uint64_t(1) << 62})
+    {
+        IntCharDfaImage::Header bh = h;
+        bh.statesNum = statesNum;
+        bad = img;
+        std::memcpy(bad.data(), &bh, sizeof(bh));
+        rewrite(bad);
+        EXPECT_THROW(IntCharDfaImage::load(path, false), DfaImageError);
+    }
+
+    // an image of other types
+    rewrite(img);
+    EXPECT_THROW((DfaImage<short, char>::load(path)), DfaImageError);
+    EXPECT_NO_THROW(IntCharDfaImage::load(path));
+
+    std::remove(path.c_str());
+    EXPECT_THROW(IntCharDfaImage::load(path), std::system_error);
+}
@@ -0,0 +1,116 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for DfaSearcher class.
+///
+/// © DFA library contributors 2026.
+///
+/// This code is for educational purposes of the course "Algorithms and Data 
+/// Structures" provided by the School of Software Engineering of the Faculty 
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <string>
+
+#include "fsa/dfa_search.hpp"
+#include "fsa/regex.hpp"
+
+
+typedef Dfa<int, char> IntCharDfa;
+typedef DfaPlayer<int, char> IntCharDfaPlayer;
+typedef DfaSearcher<char> CharDfaSearcher;
+typedef std::vector<std::uint64_t> Offsets;
+
+
+/// Finds end offsets of matches by replaying every substring.
+static Offsets bruteForce(const IntCharDfa& dfa, const std::string& s)
+{
+    IntCharDfaPlayer player(dfa);
+    Offsets res;
+    for (size_t e = 0; e <= s.size(); ++e)
+    {
+        for (size_t b = 0; b <= e; ++b)
+        {
+            if (player.play(s.data() + b, e - b) == IntCharDfaPlayer::Result::Ok)
+            {
+                res.push_back(e);
+                break;
+            }
+        }
+    }
+    return res;
+}
+
+TEST(DfaSearcher, findAll)
+{
+    IntCharDfa dfa = RegexCompiler::compile("ab+|ca");
+    CharDfaSearcher searcher(dfa);
+
+    Offsets offs;
+    std::string s = "xabbcabx-ca";
+    EXPECT_EQ(5, searcher.search(s.data(), s.size(), offs));
+    EXPECT_EQ(Offsets({3, 4, 6, 7, 11}), offs);
+    EXPECT_EQ(bruteForce(dfa, s), offs);
+}
+
+TEST(DfaSearcher, emptyWord)
+{
+    IntCharDfa dfa = RegexCompiler::compile("a*");
+    CharDfaSearcher searcher(dfa);
+
+    Offsets offs;
+    searcher.search("bab", 3, offs);
+    EXPECT_EQ(Offsets({0, 1, 2, 3}), offs);
+}
+
+TEST(DfaSearcher, batchesAndChunks)
+{
+    IntCharDfa dfa = RegexCompiler::compile("a");
+    CharDfaSearcher searcher(dfa);
+
+    std::string s(1000, 'a');
+    size_t batches = 0;
+    Offsets offs;
+    auto sink = [&](const std::uint64_t* o, size_t n)
+    {
+        ++batches;
+        EXPECT_LE(n, CharDfaSearcher::BatchSize);
+        offs.insert(offs.end(), o, o + n);
+    };
+
+    searcher.begin();
+    for (size_t i = 0; i < s.size(); i += 7)
+        searcher.feed(s.data() + i, std::min<size_t>(7, s.size() - i), sink);
+    searcher.finish(sink);
+
+    EXPECT_EQ(4, batches);
+    ASSERT_EQ(1000, offs.size());
+    EXPECT_EQ(1, offs.front());
+    EXPECT_EQ(1000, offs.back());
+}
+
+TEST(DfaSearcher, random)
+{
+    std::srand(3);
+    for (const char* re : {"(a|b)*abb", "a{2,3}c?", "b[ac]b", "c*"})
+    {
+        IntCharDfa dfa = RegexCompiler::compile(re);
+        CharDfaSearcher searcher(dfa);
+        for (int w = 0; w < 20; ++w)
+        {
+            std::string s(std::rand() % 30, ' ');
+            for (char& a : s)
+                a = "abcd"[std::rand() % 4];
+
+            Offsets offs;
+            searcher.search(std::string_view(s), [&offs](const std::uint64_t* o, size_t n)
+                            { offs.insert(offs.end(), o, o + n); });
+            EXPECT_EQ(bruteForce(dfa, s), offs);
+        }
+    }
+}
@@ -14,7 +14,11 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdlib>
 #include <map>
+#include <set>
+#include <string>
+#include <type_traits>
 
 #include "fsa/dfa.hpp"
 
@@ -91,3 +95,421 @@ TEST(DfaPlayer, replay1)
 }
 
 
+
+
+// Minimization
+
+TEST(Dfa, minimizeExample1)
+{
+    // states 2 and 3 are equivalent, state 4 is unreachable
+    IntCharDfa dfa{0,
+                   { {0, '1', 0}, {0, '0', 1},
+                     {1, '0', 1}, {1, '1', 2},
+                     {2, '0', 3}, {2, '1', 2},
+                     {3, '0', 2}, {3, '1', 3},
+                     {4, '0', 2}
+                   },
+                   { 2, 3 }
+                  };
+    std::map<int, int> oldToNew;
+    IntCharDfa min = dfa.minimize(&oldToNew);
+
+    EXPECT_EQ(3, min.getStatesNum());
+    EXPECT_EQ(6, min.getTransNum());
+    EXPECT_EQ(0, min.getInitState());
+    EXPECT_EQ(1, min.getFinStatesNum());
+    EXPECT_TRUE(min.hasFinState(2));
+    EXPECT_EQ(4, oldToNew.size());
+    EXPECT_EQ(2, oldToNew[3]);
+    EXPECT_EQ(1, oldToNew[1]);
+}
+
+TEST(Dfa, minimizeDropsDeadStates)
+{
+    IntCharDfa dfa{0, { {0, 'a', 1}, {0, 'b', 2}, {2, 'a', 2} }, { 1 }};
+    IntCharDfa min = dfa.minimize();
+
+    EXPECT_EQ(2, min.getStatesNum());
+    EXPECT_EQ(1, min.getTransNum());
+
+    IntCharDfa empty{0, { {0, 'a', 1} }, {}};
+    min = empty.minimize();
+    EXPECT_EQ(1, min.getStatesNum());
+    EXPECT_EQ(0, min.getTransNum());
+    EXPECT_EQ(0, min.getFinStatesNum());
+}
+
+/// \return target of the transition from \a q by \a a of a complete \a dfa.
+static int getCompleteTrans(const IntCharDfa& dfa, int q, char a)
+{
+    int d = -1;
+    bool isTrans = dfa.getTrans(q, a, d);
+    EXPECT_TRUE(isTrans);
+    return isTrans ? d : q;             // q keeps indexing by states valid
+}
+
+/// Counts classes of equivalent states among reachable ones of a complete
+/// DFA by naive Moore refinement, the class of dead states excluded.
+static size_t countMooreClasses(const IntCharDfa& dfa, int n, const std::string& abc)
+{
+    std::vector<int> cls(n);
+    for (int q = 0; q < n; ++q)
+        cls[q] = dfa.hasFinState(q) ? 1 : 0;
+    for (;;)
+    {
+        std::map<std::vector<int>, int> sigs;
+        std::vector<int> next(n);
+        for (int q = 0; q < n; ++q)
+        {
+            std::vector<int> sig = {cls[q]};
+            for (char a : abc)
+            {
+                sig.push_back(cls[getCompleteTrans(dfa, q, a)]);
+            }
+            next[q] = sigs.insert({sig, int(sigs.size())}).first->second;
+        }
+        bool same = (std::set<int>(next.begin(), next.end()).size()
+                     == std::set<int>(cls.begin(), cls.end()).size());
+        cls = next;
+        if (same)
+            break;
+    }
+
+    // reachable states and whether they can accept
+    std::set<int> reach = {dfa.getInitState()};
+    std::vector<int> stack = {dfa.getInitState()};
+    while (!stack.empty())
+    {
+        int q = stack.back();
+        stack.pop_back();
+        for (char a : abc)
+        {
+            int d = getCompleteTrans(dfa, q, a);
+            if (reach.insert(d).second)
+                stack.push_back(d);
+        }
+    }
+    std::vector<bool> live(n);
+    for (bool changed = true; changed; )
+    {
+        changed = false;
+        for (int q = 0; q < n; ++q)
+        {
+            bool l = dfa.hasFinState(q);
+            for (char a : abc)
+            {
+                l = l || live[getCompleteTrans(dfa, q, a)];
+            }
+            changed = changed || (l != live[q]);
+            live[q] = l;
+        }
+    }
+
+    // states, which cannot accept, form a single class that is dropped
+    std::set<int> classes;
+    for (int q : reach)
+    {
+        if (live[q])
+            classes.insert(cls[q]);
+    }
+    return classes.size();
+}
+
+TEST(Dfa, minimizeRandom)
+{
+    const std::string abc = "abc";
+    std::srand(42);
+    for (int iter = 0; iter < 50; ++iter)
+    {
+        int n = 2 + std::rand() % 30;
+        IntCharDfa dfa;
+        dfa.addState(0);
+        for (int q = 0; q < n; ++q)
+        {
+            for (char a : abc)
+                dfa.addTrans(q, a, std::rand() % n);
+            if (std::rand() % 3 == 0)
+                dfa.addFinState(q);
+        }
+        IntCharDfa min = dfa.minimize();
+
+        EXPECT_EQ(countMooreClasses(dfa, n, abc),
+                  dfa.getFinStatesNum() ? min.getStatesNum() : 0);
+
+        // both automata accept the same words
+        IntCharDfaPlayer p1(dfa), p2(min);
+        for (int w = 0; w < 50; ++w)
+        {
+            std::vector<char> seq(std::rand() % 10);
+            for (char& a : seq)
+                a = abc[std::rand() % abc.size()];
+            EXPECT_EQ(p1.play(seq) == IntCharDfaPlayer::Result::Ok,
+                      p2.play(seq) == IntCharDfaPlayer::Result::Ok);
+        }
+    }
+}
+
+TEST(Dfa, minimizeRandomPartial)
+{
+    const std::string abc = "ab";
+    std::srand(7);
+    for (int iter = 0; iter < 50; ++iter)
+    {
+        // a partial automaton and its completion with the dead state n
+        int n = 2 + std::rand() % 20;
+        IntCharDfa dfa, full;
+        dfa.addState(0);
+        full.addState(0);
+        for (int q = 0; q < n; ++q)
+        {
+            for (char a : abc)
+            {
+                int d = (std::rand() % 4 == 0) ? n : std::rand() % n;
+                if (d != n)
+                    dfa.addTrans(q, a, d);
+                full.addTrans(q, a, d);
+            }
+            if (std::rand() % 3 == 0)
+            {
+                dfa.addFinState(q);
+                full.addFinState(q);
+            }
+        }
+        for (char a : abc)
+            full.addTrans(n, a, n);
+
+        IntCharDfa min = dfa.minimize();
+        size_t expected = countMooreClasses(full, n + 1, abc);
+        EXPECT_EQ(expected ? expected : 1, min.getStatesNum());
+    }
+}
+
+TEST(DfaPlayer, replayNoCopy)
+{
+    IntCharDfa dfa{0,                           // init state
+                   { {0, '1', 0}, {0, '0', 1},  // trans table
+                     {1, '0', 1}, {1, '1', 2},
+                     {2, '0', 2}, {2, '1', 2}
+                   },
+                   { 2 }                        // fin states
+                  };
+    IntCharDfaPlayer player(dfa);
+
+    const char buf[] = "1010100";
+    EXPECT_EQ(IntCharDfaPlayer::Result::Ok, player.play(buf, 4));
+    EXPECT_EQ(IntCharDfaPlayer::Result::Ok, player.play(buf + 1, buf + 4));
+    EXPECT_EQ(IntCharDfaPlayer::Result::NonFinState, player.play(std::string_view("100")));
+    EXPECT_EQ(3, player.getCurPos());
+
+    std::string str = "10x";
+    EXPECT_EQ(IntCharDfaPlayer::Result::NoTrans, player.play(str.begin(), str.end()));
+    EXPECT_EQ(2, player.getCurPos());
+    EXPECT_EQ('x', player.getLastSymbol());
+
+    std::set<char> ordered = {'0', '1'};
+    EXPECT_EQ(IntCharDfaPlayer::Result::Ok, player.play(ordered.begin(), ordered.end()));
+}
+
+TEST(DfaPlayer, replayByChunks)
+{
+    IntCharDfa dfa{0,                           // init state
+                   { {0, '1', 0}, {0, '0', 1},  // trans table
+                     {1, '0', 1}, {1, '1', 2},
+                     {2, '0', 2}, {2, '1', 2}
+                   },
+                   { 2 }                        // fin states
+                  };
+    IntCharDfaPlayer player(dfa);
+
+    static_assert(std::is_same<std::uint64_t,
+                               decltype(player.getCurPos())>::value,
+                  "position must not overflow on long streams");
+
+    player.begin();
+    EXPECT_TRUE(player.feed(std::string_view("11")));
+    EXPECT_EQ(IntCharDfaPlayer::Result::NonFinState, player.finish());
+    EXPECT_TRUE(player.feed(std::string_view("")));
+    EXPECT_TRUE(player.feed(std::vector<char>{'0', '0'}));
+    EXPECT_TRUE(player.feed("10", 2));
+    EXPECT_EQ(IntCharDfaPlayer::Result::Ok, player.finish());
+    EXPECT_EQ(6, player.getCurPos());
+
+    // a broken replay ignores the rest of chunks
+    player.begin();
+    EXPECT_TRUE(player.feed(std::string_view("01")));
+    EXPECT_FALSE(player.feed(std::string_view("1x1")));
+    EXPECT_FALSE(player.feed(std::string_view("11")));
+    EXPECT_EQ(IntCharDfaPlayer::Result::NoTrans, player.finish());
+    EXPECT_EQ(3, player.getCurPos());
+    EXPECT_EQ('x', player.getLastSymbol());
+}
+
+/// Listener policy counting events of a player.
+struct CountingListener {
+    int starts = 0;
+    int fired = 0;
+    std::string path;
+
+    void onStateChanging(int /*preS*/, int newS)
+    {
+        ++starts;
+        path = std::to_string(newS);
+    }
+
+    void onTransFired(int /*s*/, char /*a*/, int d)
+    {
+        ++fired;
+        path += std::to_string(d);
+    }
+}; // struct CountingListener
+
+TEST(BasicDfaPlayer, staticListener)
+{
+    IntCharDfa dfa{0,                           // init state
+                   { {0, '1', 0}, {0, '0', 1},  // trans table
+                     {1, '0', 1}, {1, '1', 2},
+                     {2, '0', 2}, {2, '1', 2}
+                   },
+                   { 2 }                        // fin states
+                  };
+
+    BasicDfaPlayer<int, char, CountingListener> player(dfa);
+    EXPECT_EQ(PlayResult::Ok, player.play(std::string_view("1010")));
+    EXPECT_EQ(1, player.getListener().starts);
+    EXPECT_EQ(4, player.getListener().fired);
+    EXPECT_EQ("00122", player.getListener().path);
+
+    EXPECT_EQ(PlayResult::NoTrans, player.play(std::string_view("0x")));
+    EXPECT_EQ(5, player.getListener().fired);
+    EXPECT_EQ("01", player.getListener().path);
+
+    // a null listener leaves the semantics as is
+    BasicDfaPlayer<int, char, NullListener> bare(dfa);
+    IntCharDfaPlayer ref(dfa);
+    for (const char* seq : {"", "1", "01", "0x1", "1100", "0110"})
+    {
+        EXPECT_EQ(ref.play(std::string_view(seq)),
+                  bare.play(std::string_view(seq)));
+        EXPECT_EQ(ref.getCurPos(), bare.getCurPos());
+        EXPECT_EQ(ref.getCurState(), bare.getCurState());
+    }
+}
+
+/// Runtime listener recording fired transitions.
+class RecordingListener : public IntCharDfaPlayer::IEventListener {
+public:
+    virtual void onStateChanging(int /*preS*/, int /*newS*/) override {}
+
+    virtual void onTransFired(int s, char a, int d) override
+    {
+        trace += std::to_string(s) + a + std::to_string(d) + ' ';
+    }
+
+    std::string trace;
+}; // class RecordingListener
+
+TEST(DfaPlayer, runtimeListener)
+{
+    IntCharDfa dfa{0, { {0, 'a', 1}, {1, 'b', 0} }, { 1 }};
+    RecordingListener cb;
+    IntCharDfaPlayer player(dfa, &cb);
+    EXPECT_EQ(&cb, player.getEventListener());
+
+    EXPECT_EQ(IntCharDfaPlayer::Result::Ok, player.play(std::string_view("aba")));
+    EXPECT_EQ("0a1 1b0 0a1 ", cb.trace);
+
+    player.setEventListener(nullptr);
+    EXPECT_EQ(IntCharDfaPlayer::Result::Ok, player.play(std::string_view("a")));
+    EXPECT_EQ("0a1 1b0 0a1 ", cb.trace);
+}
+
+
+// Fates of states
+
+TEST(Dfa, fates)
+{
+    // state 2 accepts forever on binary strings, state 3 rejects forever
+    IntCharDfa dfa{0,
+                   { {0, '1', 0}, {0, '0', 1},
+                     {1, '0', 1}, {1, '1', 2},
+                     {2, '0', 2}, {2, '1', 2},
+                     {3, '0', 3}, {3, '1', 3}
+                   },
+                   { 2 }
+                  };
+
+    // other symbols still break a replay off
+    EXPECT_TRUE(dfa.getFates().empty());
+
+    IntCharDfa::Fates fates = dfa.getFates(true);
+    EXPECT_EQ(2, fates.size());
+    EXPECT_EQ(StateFate::Accept, fates[2]);
+    EXPECT_EQ(StateFate::Reject, fates[3]);
+
+    // a missing transition makes the states reaching it open
+    dfa.addTrans(2, 'x', 4);
+    dfa.addTrans(3, 'x', 3);
+    fates = dfa.getFates(true);
+    EXPECT_EQ(1, fates.size());
+    EXPECT_EQ(StateFate::Reject, fates[3]);
+
+    // a state looping on every byte is certain without assumptions
+    IntCharDfa any{0, {}, { 1 }};
+    for (int v = -128; v < 128; ++v)
+    {
+        any.addTrans(0, char(v), v == '#' ? 1 : 0);
+        any.addTrans(1, char(v), 1);
+    }
+    fates = any.getFates();
+    EXPECT_EQ(1, fates.size());
+    EXPECT_EQ(StateFate::Accept, fates[1]);
+}
+
+TEST(DfaPlayer, stopsOnFates)
+{
+    IntCharDfa dfa{0,
+                   { {0, '1', 0}, {0, '0', 1},
+                     {1, '0', 1}, {1, '1', 2},
+                     {2, '0', 2}, {2, '1', 2}
+                   },
+                   { 2 }
+                  };
+    IntCharDfa::Fates fates = dfa.getFates(true);
+    RecordingListener cb;
+    IntCharDfaPlayer player(dfa, &cb);
+    player.setFates(&fates);
+    EXPECT_EQ(&fates, player.getFates());
+
+    // the result, the position and the last symbol stay as they are
+    EXPECT_EQ(IntCharDfaPlayer::Result::Ok,
+              player.play(std::string_view("1011000")));
+    EXPECT_TRUE(player.isDecided());
+    EXPECT_EQ(7, player.getCurPos());
+    EXPECT_EQ(2, player.getCurState());
+    EXPECT_EQ('0', player.getLastSymbol());
+
+    // but the transitions after the decision are not fired
+    EXPECT_EQ("010 001 112 ", cb.trace);
+
+    EXPECT_EQ(IntCharDfaPlayer::Result::NonFinState,
+              player.play(std::string_view("1100")));
+    EXPECT_FALSE(player.isDecided());
+    EXPECT_EQ(4, player.getCurPos());
+
+    // input iterators are counted one by one
+    std::set<char> ordered = {'0', '1'};
+    EXPECT_EQ(IntCharDfaPlayer::Result::Ok,
+              player.play(ordered.begin(), ordered.end()));
+    EXPECT_EQ(2, player.getCurPos());
+
+    // chunks after the decision are only counted
+    player.setEventListener(nullptr);
+    player.begin();
+    EXPECT_TRUE(player.feed(std::string_view("01")));
+    EXPECT_TRUE(player.isDecided());
+    EXPECT_TRUE(player.feed(std::string_view("110")));
+    EXPECT_TRUE(player.feed(std::vector<char>{'1'}));
+    EXPECT_EQ(IntCharDfaPlayer::Result::Ok, player.finish());
+    EXPECT_EQ(6, player.getCurPos());
+    EXPECT_EQ('1', player.getLastSymbol());
+}
@@ -0,0 +1,87 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for DfaHeatMap class.
+///
+/// © DFA library contributors 2026.
+///
+/// This code is for educational purposes of the course "Algorithms and Data 
+/// Structures" provided by the School of Software Engineering of the Faculty 
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "fsa/heat_map.hpp"
+
+
+typedef Dfa<int, char> IntCharDfa;
+typedef CompiledDfa<int, char> IntCharCompiledDfa;
+typedef DfaHeatMap<int, char> IntCharHeatMap;
+typedef BasicCompiledDfaPlayer<int, char, HeatMapListener<int, char>>
+        ProfilingPlayer;
+
+
+TEST(DfaHeatMap, countReplays)
+{
+    IntCharDfa dfa{0,                           // init state
+                   { {0, '1', 0}, {0, '0', 1},  // trans table
+                     {1, '0', 1}, {1, '1', 2},
+                     {2, '0', 2}, {2, '1', 2}
+                   },
+                   { 2 }                        // fin states
+                  };
+    IntCharCompiledDfa cdfa(dfa);
+    IntCharHeatMap heat(cdfa);
+    ProfilingPlayer player(cdfa, HeatMapListener<int, char>(heat));
+
+    EXPECT_EQ(PlayResult::Ok, player.play(std::string_view("1010")));
+    EXPECT_EQ(PlayResult::NoTrans, player.play(std::string_view("110x")));
+    EXPECT_EQ(PlayResult::NoTrans, player.play(std::string_view("x")));
+
+    IntCharCompiledDfa::Index s0, s1, s2, c0, c1;
+    ASSERT_TRUE(cdfa.getStateIndex(0, s0) && cdfa.getStateIndex(1, s1)
+                && cdfa.getStateIndex(2, s2));
+    ASSERT_TRUE(cdfa.getSymbolClass('0', c0) && cdfa.getSymbolClass('1', c1));
+
+    EXPECT_EQ(3, heat.getReplaysNum());
+    EXPECT_EQ(3, heat.getTransHits(s0, c1));
+    EXPECT_EQ(2, heat.getTransHits(s0, c0));
+    EXPECT_EQ(1, heat.getTransHits(s1, c1));
+    EXPECT_EQ(1, heat.getTransHits(s2, c0));
+    EXPECT_EQ(0, heat.getTransHits(s2, c1));
+
+    // 3 starts, 1 + 2 loops and nothing after the break
+    EXPECT_EQ(6, heat.getStateVisits(s0));
+    EXPECT_EQ(2, heat.getStateVisits(s1));
+    EXPECT_EQ(2, heat.getStateVisits(s2));
+
+    EXPECT_EQ(2, heat.getNoTransNum());
+    EXPECT_DOUBLE_EQ(1.5, heat.getAvgNoTransPathLen());
+
+    std::vector<IntCharHeatMap::TransHeat> top = heat.getTopTrans(2);
+    ASSERT_EQ(2, top.size());
+    EXPECT_EQ(s0, top[0].from);
+    EXPECT_EQ(c1, top[0].cls);
+    EXPECT_EQ(s0, top[0].to);
+    EXPECT_EQ(3, top[0].hits);
+    EXPECT_EQ(2, top[1].hits);
+    EXPECT_EQ(4, heat.getTopTrans(100).size());
+
+    std::ostringstream out;
+    heat.report(out, 3);
+    EXPECT_NE(std::string::npos, out.str().find("replays: 3, broken off: 2"));
+    EXPECT_NE(std::string::npos, out.str().find("0 -[class 1]-> 0: 3"));
+    EXPECT_NE(std::string::npos, out.str().find("never visited: 0"));
+
+    heat.reset();
+    EXPECT_EQ(0, heat.getReplaysNum());
+    EXPECT_EQ(0, heat.getTransHits(s0, c1));
+    EXPECT_TRUE(heat.getTopTrans(5).empty());
+}
@@ -0,0 +1,74 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for Interner classes.
+///
+/// © DFA library contributors 2026.
+///
+/// This code is for educational purposes of the course "Algorithms and Data 
+/// Structures" provided by the School of Software Engineering of the Faculty 
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "fsa/interner.hpp"
+
+
+TEST(Interner, chars)
+{
+    std::vector<char> v = {'z', 'a', 'm', 'a', -5};
+    Interner<char> in(v.begin(), v.end());
+
+    EXPECT_EQ(4, in.size());
+    EXPECT_EQ(0, in.find(-5));
+    EXPECT_EQ(1, in.find('a'));
+    EXPECT_EQ(3, in.find('z'));
+    EXPECT_EQ(NoInternId, in.find('b'));
+    EXPECT_EQ('m', in.value(2));
+}
+
+TEST(Interner, strings)
+{
+    std::vector<std::string> v = {"q2", "q0", "q1", "q0"};
+    Interner<std::string> in(v.begin(), v.end());
+
+    EXPECT_EQ(3, in.size());
+    EXPECT_EQ(0, in.find("q0"));
+    EXPECT_EQ(2, in.find("q2"));
+    EXPECT_EQ(NoInternId, in.find("q3"));
+    EXPECT_EQ("q1", in.value(1));
+}
+
+TEST(Interner, wideInts)
+{
+    std::vector<std::uint64_t> v = {1ull << 40, 7, 1ull << 40};
+    Interner<std::uint64_t> in(v.begin(), v.end());
+
+    EXPECT_EQ(2, in.size());
+    EXPECT_EQ(1, in.find(1ull << 40));
+    EXPECT_EQ(NoInternId, in.find(8));
+}
+
+TEST(ClassMap, charsAndStrings)
+{
+    std::vector<char> v = {'a', 'b', 'c'};
+    Interner<char> in(v.begin(), v.end());
+    ClassMap<char> cm(in, {0, 1, 0});
+
+    EXPECT_EQ(0, cm.find('a'));
+    EXPECT_EQ(1, cm.find('b'));
+    EXPECT_EQ(0, cm.find('c'));
+    EXPECT_EQ(NoInternId, cm.find('d'));
+
+    std::vector<std::string> w = {"x", "y"};
+    Interner<std::string> ins(w.begin(), w.end());
+    ClassMap<std::string> cms(ins, {0, 0});
+
+    EXPECT_EQ(0, cms.find("y"));
+    EXPECT_EQ(NoInternId, cms.find("z"));
+}
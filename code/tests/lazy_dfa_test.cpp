@@ -0,0 +1,91 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for LazyDfa classes.
+///
+/// © DFA library contributors 2026.
+///
+/// This code is for educational purposes of the course "Algorithms and Data 
+/// Structures" provided by the School of Software Engineering of the Faculty 
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <type_traits>
+
+#include "fsa/lazy_dfa.hpp"
+
+
+typedef Nfa<int, char> IntCharNfa;
+typedef Dfa<int, char> IntCharDfa;
+typedef DfaPlayer<int, char> IntCharDfaPlayer;
+typedef LazyDfa<int, char> IntCharLazyDfa;
+typedef LazyDfaPlayer<int, char> IntCharLazyDfaPlayer;
+
+
+/// NFA for (a|b)*a(a|b){k}, whose DFA has 2^(k+1) states.
+static IntCharNfa makeKthFromEnd(int k)
+{
+    IntCharNfa nfa{0, { {0, 'a', 0}, {0, 'b', 0}, {0, 'a', 1} }, { }, { k + 1 }};
+    for (int q = 1; q <= k; ++q)
+    {
+        nfa.addTrans(q, 'a', q + 1);
+        nfa.addTrans(q, 'b', q + 1);
+    }
+    return nfa;
+}
+
+TEST(LazyDfa, replay)
+{
+    IntCharNfa nfa = makeKthFromEnd(2);
+    IntCharLazyDfa dfa(nfa);
+    IntCharLazyDfaPlayer player(dfa);
+    EXPECT_EQ(0, player.getCurPos());
+    EXPECT_EQ('\0', player.getLastSymbol());
+
+    EXPECT_EQ(IntCharLazyDfaPlayer::Result::Ok, player.play({'a', 'b', 'b'}));
+    EXPECT_EQ(std::set<int>({0, 3}), player.getCurStates());
+    EXPECT_EQ(IntCharLazyDfaPlayer::Result::NonFinState, player.play({'a', 'b'}));
+    EXPECT_EQ(IntCharLazyDfaPlayer::Result::NoTrans, player.play({'a', 'c'}));
+    EXPECT_EQ(1, player.getCurPos());
+    EXPECT_EQ('c', player.getLastSymbol());
+
+    // only visited states are built
+    EXPECT_EQ(4, dfa.getCachedStatesNum());
+    EXPECT_EQ(0, dfa.getFlushesNum());
+
+    // the cache refers to itself, so it is neither copied nor moved
+    EXPECT_FALSE(std::is_copy_constructible<IntCharLazyDfa>::value);
+    EXPECT_FALSE(std::is_move_constructible<IntCharLazyDfa>::value);
+}
+
+TEST(LazyDfa, boundedCache)
+{
+    const int k = 10;
+    IntCharNfa nfa = makeKthFromEnd(k);
+    IntCharDfa full = nfa.determinize();
+    IntCharDfaPlayer ref(full);
+
+    const size_t limit = 4096;
+    IntCharLazyDfa dfa(nfa, limit);
+    IntCharLazyDfaPlayer player(dfa);
+
+    std::srand(1);
+    for (int w = 0; w < 200; ++w)
+    {
+        std::vector<char> seq(std::rand() % 100);
+        for (char& a : seq)
+            a = "ab"[std::rand() % 2];
+        EXPECT_EQ(ref.play(seq), player.play(seq));
+        EXPECT_LE(dfa.getMemUsed(), limit);
+    }
+
+    EXPECT_EQ(2u << k, full.getStatesNum());
+    EXPECT_LT(dfa.getCachedStatesNum(), full.getStatesNum());
+    EXPECT_GT(dfa.getMemUsed(), 0);
+    EXPECT_GT(dfa.getFlushesNum(), 0);
+}
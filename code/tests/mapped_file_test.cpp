@@ -0,0 +1,49 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for MappedFile class.
+///
+/// © DFA library contributors 2026.
+///
+/// This code is for educational purposes of the course "Algorithms and Data 
+/// Structures" provided by the School of Software Engineering of the Faculty 
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "fsa/mapped_file.hpp"
+
+
+TEST(MappedFile, readWhole)
+{
+    std::string path = testing::TempDir() + "mapped_file_test.txt";
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "1010";
+    }
+
+    {
+        MappedFile file(path);
+        EXPECT_EQ(4, file.size());
+        EXPECT_EQ("1010", std::string(file.data(), file.size()));
+    }
+
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    }
+    {
+        MappedFile file(path);
+        EXPECT_EQ(0, file.size());
+        EXPECT_EQ(nullptr, file.data());
+    }
+
+    std::remove(path.c_str());
+    EXPECT_THROW(MappedFile file(path), std::system_error);
+}
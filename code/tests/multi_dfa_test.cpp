@@ -0,0 +1,130 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for multi-pattern matching classes.
+///
+/// © DFA library contributors 2026.
+///
+/// This code is for educational purposes of the course "Algorithms and Data 
+/// Structures" provided by the School of Software Engineering of the Faculty 
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <string>
+
+#include "fsa/multi_dfa.hpp"
+#include "fsa/regex.hpp"
+
+
+typedef MultiDfaMatcher<char> CharMatcher;
+typedef std::vector<CharMatcher::Match> Matches;
+
+
+/// Finds matches of literals by comparing every substring.
+static Matches bruteForce(const std::vector<std::string>& lits, const std::string& s)
+{
+    Matches res;
+    for (size_t e = 0; e <= s.size(); ++e)
+    {
+        for (RuleId r = 0; r < lits.size(); ++r)
+        {
+            if (lits[r].size() <= e && s.compare(e - lits[r].size(), lits[r].size(), lits[r]) == 0)
+                res.push_back({r, e});
+        }
+    }
+    return res;
+}
+
+TEST(MultiDfa, regexRules)
+{
+    MultiDfaBuilder<char> builder;
+    builder.addRule(7, RegexCompiler::compile("ab+"));
+    builder.addRule(3, RegexCompiler::compile("b[0-9]"));
+    builder.addRule(5, RegexCompiler::compile("bb"));
+    CompiledMultiDfa<char> dfa = builder.build();
+    CharMatcher matcher(dfa);
+
+    Matches ms;
+    std::string s = "abb1-b2";
+    EXPECT_EQ(5, matcher.match(s.data(), s.size(), ms));
+    EXPECT_EQ(Matches({{7, 2}, {5, 3}, {7, 3}, {3, 4}, {3, 7}}), ms);
+}
+
+TEST(MultiDfa, ahoCorasick)
+{
+    std::vector<std::string> lits = {"he", "she", "his", "hers", "e"};
+    AhoCorasickBuilder<char> builder;
+    for (RuleId r = 0; r < lits.size(); ++r)
+        builder.addLiteral(r, std::string_view(lits[r]));
+    CompiledMultiDfa<char> dfa = builder.build();
+    CharMatcher matcher(dfa);
+
+    Matches ms;
+    std::string s = "ushers his";
+    matcher.match(s.data(), s.size(), ms);
+    EXPECT_EQ(bruteForce(lits, s), ms);
+}
+
+TEST(MultiDfa, ahoCorasickSameAsUnion)
+{
+    std::srand(11);
+    for (int iter = 0; iter < 20; ++iter)
+    {
+        std::vector<std::string> lits(1 + std::rand() % 8);
+        AhoCorasickBuilder<char> ac;
+        MultiDfaBuilder<char> un;
+        for (RuleId r = 0; r < lits.size(); ++r)
+        {
+            lits[r].resize(1 + std::rand() % 4);
+            for (char& a : lits[r])
+                a = "abc"[std::rand() % 3];
+            ac.addLiteral(r, std::string_view(lits[r]));
+            un.addRule(r, RegexCompiler::compile(lits[r]));
+        }
+        CompiledMultiDfa<char> acDfa = ac.build();
+        CompiledMultiDfa<char> unDfa = un.build();
+        CharMatcher acMatcher(acDfa), unMatcher(unDfa);
+
+        std::string s(std::rand() % 40, ' ');
+        for (char& a : s)
+            a = "abcd"[std::rand() % 4];
+
+        Matches m1, m2;
+        acMatcher.match(s.data(), s.size(), m1);
+        unMatcher.match(s.data(), s.size(), m2);
+        EXPECT_EQ(bruteForce(lits, s), m1);
+        EXPECT_EQ(m1, m2);
+    }
+}
+
+TEST(MultiDfa, emptyLiteralAndBatches)
+{
+    AhoCorasickBuilder<char> builder;
+    builder.addLiteral(0, std::string_view(""));
+    builder.addLiteral(1, std::string_view("a"));
+    CompiledMultiDfa<char> dfa = builder.build();
+    CharMatcher matcher(dfa);
+
+    std::string s(300, 'a');
+    Matches ms;
+    size_t batches = 0;
+    auto sink = [&](const CharMatcher::Match* m, size_t n)
+    {
+        ++batches;
+        ms.insert(ms.end(), m, m + n);
+    };
+    matcher.begin();
+    matcher.feed(s.data(), 100, sink);
+    matcher.feed(s.data() + 100, 200, sink);
+    matcher.finish(sink);
+
+    EXPECT_EQ(601, ms.size());
+    EXPECT_EQ(3, batches);
+    EXPECT_EQ(0, ms.front().end);
+    EXPECT_EQ(300, ms.back().end);
+}
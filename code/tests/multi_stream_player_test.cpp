@@ -0,0 +1,104 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for MultiStreamDfaPlayer class.
+///
+/// © DFA library contributors 2026.
+///
+/// This code is for educational purposes of the course "Algorithms and Data 
+/// Structures" provided by the School of Software Engineering of the Faculty 
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "fsa/multi_stream_player.hpp"
+#include "fsa/regex.hpp"
+
+
+typedef CompiledDfa<int, char> IntCharCompiledDfa;
+typedef BasicCompiledDfaPlayer<int, char, NullListener> IntCharBareDfaPlayer;
+typedef MultiStreamDfaPlayer<int, char> IntCharMultiStreamDfaPlayer;
+
+
+/// Checks outcomes of \a seqs replayed by \a mplayer against a plain player.
+template<typename State, typename Alpha, typename Seq>
+void expectSameAsPlayer(const CompiledDfa<State, Alpha>& dfa,
+                        MultiStreamDfaPlayer<State, Alpha>& mplayer,
+                        const std::vector<Seq>& seqs)
+{
+    auto results = mplayer.playStreams(seqs);
+    ASSERT_EQ(seqs.size(), results.size());
+
+    BasicCompiledDfaPlayer<State, Alpha, NullListener> player(dfa);
+    for (size_t i = 0; i < seqs.size(); ++i)
+    {
+        EXPECT_EQ(player.play(seqs[i].begin(), seqs[i].end()), results[i].result);
+        EXPECT_EQ(player.getCurPos(), results[i].pos);
+        EXPECT_EQ(player.getCurIndex(), results[i].state);
+        if (!seqs[i].empty())
+        {
+            EXPECT_EQ(player.getLastSymbol(), results[i].lastSymb);
+        }
+    }
+}
+
+
+TEST(MultiStreamDfaPlayer, sameAsPlayer)
+{
+    IntCharCompiledDfa dfa(RegexCompiler::compile("(a|b)*abb(c*|a)"));
+
+    // sequences of uneven lengths, some broken off by missing transitions
+    // or unknown symbols
+    std::mt19937 rnd(3);
+    std::vector<std::string> seqs(1000);
+    for (std::string& s : seqs)
+    {
+        size_t len = (rnd() % 10 == 0) ? rnd() % 3000 : rnd() % 40;
+        for (size_t i = 0; i < len; ++i)
+            s += "abbc"[rnd() % 4];
+        if (rnd() % 3 == 0)
+            s += "abb";
+        if (!s.empty() && rnd() % 5 == 0)
+            s[rnd() % s.size()] = "xa"[rnd() % 2];
+    }
+
+    for (SimdLevel level : { SimdLevel::None, SimdLevel::Avx2,
+                             SimdLevel::Avx512 })
+    {
+        IntCharMultiStreamDfaPlayer mplayer(dfa, level);
+        EXPECT_TRUE(mplayer.getSimdLevel() <= level);
+
+        expectSameAsPlayer(dfa, mplayer, seqs);
+
+        // fewer sequences than lanes, and none
+        expectSameAsPlayer(dfa, mplayer, std::vector<std::string>(
+                               seqs.begin(), seqs.begin() + 5));
+        EXPECT_TRUE(mplayer.playStreams(std::vector<std::string>()).empty());
+    }
+
+    // gathers are used only if asked for
+    IntCharMultiStreamDfaPlayer mplayer(dfa);
+    EXPECT_EQ(SimdLevel::None, mplayer.getSimdLevel());
+}
+
+TEST(MultiStreamDfaPlayer, wideSymbols)
+{
+    // symbols without a direct table of classes are replayed by scalar code
+    Dfa<int, int> ndfa{0, { {0, 100000, 1}, {1, -7, 0}, {1, 100000, 1} },
+                       { 1 }};
+    CompiledDfa<int, int> dfa(ndfa);
+    MultiStreamDfaPlayer<int, int> mplayer(dfa, detectSimdLevel());
+    EXPECT_EQ(SimdLevel::None, mplayer.getSimdLevel());
+
+    std::vector<std::vector<int>> seqs = {
+        {}, {100000}, {100000, -7}, {100000, 100000, -7, 100000}, {-7}, {5}
+    };
+    expectSameAsPlayer(dfa, mplayer, seqs);
+}
@@ -0,0 +1,105 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for Nfa classes.
+///
+/// © DFA library contributors 2026.
+///
+/// This code is for educational purposes of the course "Algorithms and Data 
+/// Structures" provided by the School of Software Engineering of the Faculty 
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "fsa/nfa.hpp"
+
+
+typedef Nfa<int, char> IntCharNfa;
+typedef Dfa<int, char> IntCharDfa;
+typedef DfaPlayer<int, char> IntCharDfaPlayer;
+
+
+/// Thompson's NFA for (a|b)*abb.
+static IntCharNfa makeAbb()
+{
+    return IntCharNfa{0,
+                      { {2, 'a', 3}, {4, 'b', 5}, {7, 'a', 8},
+                        {8, 'b', 9}, {9, 'b', 10} },
+                      { {0, 1}, {0, 7}, {1, 2}, {1, 4}, {3, 6}, {5, 6},
+                        {6, 1}, {6, 7} },
+                      { 10 }};
+}
+
+TEST(Nfa, makeAbb)
+{
+    IntCharNfa nfa = makeAbb();
+
+    EXPECT_EQ(11, nfa.getStatesNum());
+    EXPECT_EQ(2, nfa.getSymbolsNum());
+    EXPECT_EQ(5, nfa.getTransNum());
+    EXPECT_EQ(8, nfa.getEpsTransNum());
+    EXPECT_EQ(0, nfa.getInitState());
+    EXPECT_EQ(1, nfa.getFinStatesNum());
+}
+
+TEST(Nfa, epsClosure)
+{
+    IntCharNfa nfa = makeAbb();
+
+    EXPECT_EQ(IntCharNfa::States({0, 1, 2, 4, 7}), nfa.getEpsClosure({0}));
+    EXPECT_EQ(IntCharNfa::States({1, 2, 4, 5, 6, 7}), nfa.getEpsClosure({5}));
+    EXPECT_EQ(IntCharNfa::States({10}), nfa.getEpsClosure({10}));
+}
+
+TEST(Nfa, determinizeAbb)
+{
+    IntCharDfa dfa = makeAbb().determinize();
+
+    // the dragon book gives exactly 5 states A..E
+    EXPECT_EQ(5, dfa.getStatesNum());
+    EXPECT_EQ(10, dfa.getTransNum());
+    EXPECT_EQ(0, dfa.getInitState());
+    EXPECT_EQ(1, dfa.getFinStatesNum());
+    EXPECT_EQ(4, dfa.minimize().getStatesNum());
+
+    IntCharDfaPlayer player(dfa);
+    EXPECT_EQ(IntCharDfaPlayer::Result::Ok, player.play({'a', 'b', 'b'}));
+    EXPECT_EQ(IntCharDfaPlayer::Result::Ok, player.play({'b', 'a', 'a', 'b', 'b'}));
+    EXPECT_EQ(IntCharDfaPlayer::Result::NonFinState, player.play({'a', 'b'}));
+    EXPECT_EQ(IntCharDfaPlayer::Result::NonFinState, player.play({}));
+}
+
+TEST(Nfa, determinizePartial)
+{
+    // "ab" or "ac" with a shared eps-branching start
+    IntCharNfa nfa{0,
+                   { {1, 'a', 2}, {2, 'b', 3}, {4, 'a', 5}, {5, 'c', 6} },
+                   { {0, 1}, {0, 4} },
+                   { 3, 6 }};
+    IntCharDfa dfa = nfa.determinize();
+
+    EXPECT_EQ(4, dfa.getStatesNum());
+    IntCharDfaPlayer player(dfa);
+    EXPECT_EQ(IntCharDfaPlayer::Result::Ok, player.play({'a', 'c'}));
+    EXPECT_EQ(IntCharDfaPlayer::Result::NoTrans, player.play({'b'}));
+    EXPECT_EQ(IntCharDfaPlayer::Result::NoTrans, player.play({'a', 'b', 'b'}));
+    EXPECT_EQ(2, player.getCurPos());
+}
+
+TEST(Nfa, determinizeStringStates)
+{
+    Nfa<std::string, char> nfa{"s",
+                               { {"s", 'x', "s"}, {"s", 'x', "t"} },
+                               { },
+                               { "t" }};
+    IntCharDfa dfa = nfa.determinize();
+
+    EXPECT_EQ(2, dfa.getStatesNum());
+    IntCharDfaPlayer player(dfa);
+    EXPECT_EQ(IntCharDfaPlayer::Result::Ok, player.play({'x', 'x'}));
+}
@@ -0,0 +1,117 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for ParallelDfaPlayer class.
+///
+/// © DFA library contributors 2026.
+///
+/// This code is for educational purposes of the course "Algorithms and Data 
+/// Structures" provided by the School of Software Engineering of the Faculty 
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "fsa/batch_player.hpp"
+#include "fsa/parallel_player.hpp"
+#include "fsa/regex.hpp"
+
+
+typedef SharedDfa<int, char> IntCharSharedDfa;
+typedef ParallelDfaPlayer<int, char> IntCharParallelDfaPlayer;
+
+
+TEST(ParallelDfaPlayer, sameAsPlayer)
+{
+    IntCharSharedDfa dfa(RegexCompiler::compile("(a|b)*abb(c*|a)"));
+    ASSERT_LE(dfa->getStatesNum(), IntCharParallelDfaPlayer::DefMaxStatesNum);
+
+    // long sequences, accepted, declined in a nonfinal state and broken off
+    // near the beginning, in the middle and at the very end
+    std::mt19937 rnd(7);
+    std::vector<std::string> strs;
+    for (size_t len : {size_t(0), size_t(1000), size_t(300000),
+                       size_t(1234567)})
+    {
+        std::string s;
+        for (size_t i = 0; i < len; ++i)
+            s += "abbc"[rnd() % 4];
+        strs.push_back(s);
+        strs.push_back(s + "abb");
+        strs.push_back(s + "abbcccc");
+        for (size_t pos : {len / 3, len - len / 10, len})
+        {
+            std::string t = s + "abbc";
+            t[pos] = 'x';
+            strs.push_back(t);
+        }
+    }
+    strs.push_back(std::string());      // empty after the others
+
+    SharedDfaPlayer<int, char> player(dfa);
+    for (size_t threadsNum : {1, 3, 8})
+    {
+        WorkStealingPool pool(threadsNum);
+        IntCharParallelDfaPlayer pplayer(dfa, pool);
+        for (const std::string& s : strs)
+        {
+            EXPECT_EQ(player.play(std::string_view(s)),
+                      pplayer.play(std::string_view(s)));
+            EXPECT_EQ(player.getCurPos(), pplayer.getCurPos());
+            EXPECT_EQ(player.getCurIndex(), pplayer.getCurIndex());
+            EXPECT_EQ(player.getCurState(), pplayer.getCurState());
+            EXPECT_EQ(player.getLastSymbol(), pplayer.getLastSymbol());
+        }
+    }
+}
+
+TEST(ParallelDfaPlayer, isSplit)
+{
+    IntCharSharedDfa dfa(RegexCompiler::compile("(a|b)*abb"));
+    const size_t len = 4 * IntCharParallelDfaPlayer::MinChunkLen;
+
+    WorkStealingPool pool1(1);
+    EXPECT_FALSE(IntCharParallelDfaPlayer(dfa, pool1).isSplit(len));
+
+    WorkStealingPool pool(4);
+    IntCharParallelDfaPlayer player(dfa, pool);
+    EXPECT_TRUE(player.isSplit(len));
+    EXPECT_FALSE(player.isSplit(IntCharParallelDfaPlayer::MinChunkLen));
+
+    // too many states for the limit
+    IntCharParallelDfaPlayer small(dfa, pool, 1);
+    EXPECT_FALSE(small.isSplit(len));
+}
+
+TEST(BatchDfaPlayer, longSequences)
+{
+    IntCharSharedDfa dfa(RegexCompiler::compile("(a|b)*abb(c*|a)"));
+
+    std::mt19937 rnd(5);
+    std::vector<std::string> strs(200);
+    for (std::string& s : strs)
+    {
+        size_t len = (rnd() % 20 == 0) ? 200000 + rnd() % 100000 : rnd() % 30;
+        for (size_t i = 0; i < len; ++i)
+            s += "abbc"[rnd() % 4];
+        if (rnd() % 3 == 0)
+            s += "abb";
+    }
+    std::vector<std::string_view> seqs(strs.begin(), strs.end());
+
+    std::vector<PlayResult> expected;
+    SharedDfaPlayer<int, char> player(dfa);
+    for (std::string_view seq : seqs)
+        expected.push_back(player.play(seq));
+
+    WorkStealingPool pool(4);
+    BatchDfaPlayer<int, char> batch(dfa, pool, 1 << 14, 150000);
+    EXPECT_EQ(expected, batch.playBatch(seqs));
+}
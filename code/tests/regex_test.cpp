@@ -0,0 +1,127 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for RegexCompiler class.
+///
+/// © DFA library contributors 2026.
+///
+/// This code is for educational purposes of the course "Algorithms and Data 
+/// Structures" provided by the School of Software Engineering of the Faculty 
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "fsa/regex.hpp"
+
+
+typedef Dfa<int, char> IntCharDfa;
+typedef DfaPlayer<int, char> IntCharDfaPlayer;
+
+
+/// Checks whether the DFA \a dfa accepts the string \a s.
+static bool accepts(const IntCharDfa& dfa, const std::string& s)
+{
+    IntCharDfaPlayer player(dfa);
+    return player.play(std::vector<char>(s.begin(), s.end()))
+            == IntCharDfaPlayer::Result::Ok;
+}
+
+TEST(Regex, basics)
+{
+    IntCharDfa dfa = RegexCompiler::compile("(a|b)*abb");
+    EXPECT_EQ(4, dfa.getStatesNum());
+    EXPECT_TRUE(accepts(dfa, "abb"));
+    EXPECT_TRUE(accepts(dfa, "babaabb"));
+    EXPECT_FALSE(accepts(dfa, "ab"));
+    EXPECT_FALSE(accepts(dfa, "abbc"));
+
+    // the DFA of test1()
+    dfa = RegexCompiler::compile("1*0+1[01]*");
+    EXPECT_EQ(3, dfa.getStatesNum());
+    EXPECT_TRUE(accepts(dfa, "1010"));
+    EXPECT_FALSE(accepts(dfa, "100"));
+
+    dfa = RegexCompiler::compile("colou?r");
+    EXPECT_TRUE(accepts(dfa, "color"));
+    EXPECT_TRUE(accepts(dfa, "colour"));
+    EXPECT_FALSE(accepts(dfa, "colouur"));
+
+    dfa = RegexCompiler::compile("");
+    EXPECT_TRUE(accepts(dfa, ""));
+    EXPECT_FALSE(accepts(dfa, "a"));
+}
+
+TEST(Regex, classesAndEscapes)
+{
+    IntCharDfa dfa = RegexCompiler::compile("[a-zA-Z_]\\w*");
+    EXPECT_TRUE(accepts(dfa, "_foo42"));
+    EXPECT_FALSE(accepts(dfa, "42foo"));
+
+    dfa = RegexCompiler::compile("[^0-9]\\.\\d\\x41");
+    EXPECT_TRUE(accepts(dfa, "x.7A"));
+    EXPECT_FALSE(accepts(dfa, "7.7A"));
+
+    dfa = RegexCompiler::compile("a.c");
+    EXPECT_TRUE(accepts(dfa, "a-c"));
+    EXPECT_FALSE(accepts(dfa, "a\nc"));
+
+    dfa = RegexCompiler::compile("[]-]+");
+    EXPECT_TRUE(accepts(dfa, "]-]"));
+}
+
+TEST(Regex, boundedRepetition)
+{
+    IntCharDfa dfa = RegexCompiler::compile("a{2,4}");
+    EXPECT_FALSE(accepts(dfa, "a"));
+    EXPECT_TRUE(accepts(dfa, "aa"));
+    EXPECT_TRUE(accepts(dfa, "aaaa"));
+    EXPECT_FALSE(accepts(dfa, "aaaaa"));
+
+    dfa = RegexCompiler::compile("(ab){2,}");
+    EXPECT_FALSE(accepts(dfa, "ab"));
+    EXPECT_TRUE(accepts(dfa, "ababab"));
+
+    dfa = RegexCompiler::compile("x{3}y{0}");
+    EXPECT_TRUE(accepts(dfa, "xxx"));
+    EXPECT_FALSE(accepts(dfa, "xxxy"));
+}
+
+TEST(Regex, errors)
+{
+    EXPECT_THROW(RegexCompiler::compile("(ab"), RegexError);
+    EXPECT_THROW(RegexCompiler::compile("ab)"), RegexError);
+    EXPECT_THROW(RegexCompiler::compile("*a"), RegexError);
+    EXPECT_THROW(RegexCompiler::compile("[a-"), RegexError);
+    EXPECT_THROW(RegexCompiler::compile("[z-a]"), RegexError);
+    EXPECT_THROW(RegexCompiler::compile("a{3,2}"), RegexError);
+    EXPECT_THROW(RegexCompiler::compile("a{2"), RegexError);
+    EXPECT_THROW(RegexCompiler::compile("a\\"), RegexError);
+
+    // nested repetitions and groups are bounded
+    EXPECT_THROW(RegexCompiler::compileNfa("((a{1000}){1000}){1000}"),
+                 RegexError);
+    EXPECT_THROW(RegexCompiler::compileNfa("(a{100}b{100}){100}", 10000),
+                 RegexError);
+    EXPECT_NO_THROW(RegexCompiler::compileNfa("(a{10}b{10}){10}", 10000));
+    EXPECT_THROW(RegexCompiler::compileNfa(std::string(100000, '(')),
+                 RegexError);
+    EXPECT_THROW(RegexCompiler::compileNfa("a" + std::string(100000, '?')),
+                 RegexError);
+    EXPECT_NO_THROW(RegexCompiler::compileNfa(std::string(100, '(') + "a"
+                                              + std::string(100, ')')));
+
+    try
+    {
+        RegexCompiler::compile("ab(c");
+        FAIL();
+    }
+    catch (const RegexError& e)
+    {
+        EXPECT_EQ(2, e.getPos());
+    }
+}
@@ -0,0 +1,59 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Checks of players of compiled engines against DfaPlayer for tests.
+///
+/// © DFA library contributors 2026.
+///
+/// This code is for educational purposes of the course "Algorithms and Data
+/// Structures" provided by the School of Software Engineering of the Faculty
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef SAME_AS_DFA_PLAYER_HPP_
+#define SAME_AS_DFA_PLAYER_HPP_
+
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "fsa/dfa.hpp"
+
+
+/// Checks that \a player and \a ref agree on the last replay.
+template<typename RefPlayer, typename Player>
+void expectSameReplay(const RefPlayer& ref, const Player& player)
+{
+    EXPECT_EQ(ref.getCurState(), player.getCurState());
+    EXPECT_EQ(ref.getCurPos(), player.getCurPos());
+    EXPECT_EQ(ref.getLastSymbol(), player.getLastSymbol());
+}
+
+/// Checks replays of \a strs by \a player against the reference DfaPlayer
+/// of \a dfa. Each string is followed by an empty one, which must not keep
+/// the last symbol of the string.
+template<typename State, typename Player>
+void expectSameAsDfaPlayer(const Dfa<State, char>& dfa, Player& player,
+                           const std::vector<std::string>& strs)
+{
+    DfaPlayer<State, char> ref(dfa);
+    for (const std::string& s : strs)
+    {
+        std::string_view seq(s);
+        ASSERT_EQ(ref.play(seq), player.play(seq));
+        expectSameReplay(ref, player);
+
+        ASSERT_EQ(ref.play(std::string_view()),
+                  player.play(std::string_view()));
+        expectSameReplay(ref, player);
+    }
+}
+
+
+
+#endif // SAME_AS_DFA_PLAYER_HPP_
@@ -0,0 +1,124 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for SharedDfa classes.
+///
+/// © DFA library contributors 2026.
+///
+/// This code is for educational purposes of the course "Algorithms and Data 
+/// Structures" provided by the School of Software Engineering of the Faculty 
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "fsa/shared_dfa.hpp"
+#include "fsa/regex.hpp"
+
+
+typedef SharedDfa<int, char> IntCharSharedDfa;
+typedef SharedDfaPlayer<int, char> IntCharSharedDfaPlayer;
+
+
+/// Outcome of a replay.
+struct Outcome {
+    PlayResult res;
+    std::uint64_t pos;
+    int state;
+
+    bool operator==(const Outcome& o) const
+    {
+        return res == o.res && pos == o.pos && state == o.state;
+    }
+}; // struct Outcome
+
+
+TEST(SharedDfa, lifetime)
+{
+    IntCharSharedDfa dfa(RegexCompiler::compile("(ab)*c"));
+    EXPECT_EQ(1, dfa.getUseCount());
+
+    std::unique_ptr<IntCharSharedDfaPlayer> player;
+    {
+        IntCharSharedDfa copy = dfa;
+        EXPECT_EQ(2, copy.getUseCount());
+        player.reset(new IntCharSharedDfaPlayer(copy));
+        EXPECT_EQ(3, dfa.getUseCount());
+    }
+    EXPECT_EQ(2, dfa.getUseCount());
+
+    // the player alone keeps the automaton
+    dfa = IntCharSharedDfa(RegexCompiler::compile("x"));
+    EXPECT_EQ(1, player->getDfa().getUseCount());
+    EXPECT_EQ(PlayResult::Ok, player->play(std::string_view("ababc")));
+    EXPECT_EQ(PlayResult::NoTrans, player->play(std::string_view("x")));
+}
+
+TEST(SharedDfa, concurrentPlayers)
+{
+    IntCharSharedDfa dfa(RegexCompiler::compile(
+                             "([a-z]+[0-9]*\\.)*[a-z]+(:[0-9]{1,5})?"));
+
+    // a mix of matching, failing on the way and failing at the end
+    std::mt19937 rnd(7);
+    const char alpha[] = "abcxyz0129.:-";
+    std::vector<std::string> seqs(2000);
+    for (std::string& seq : seqs)
+    {
+        size_t len = rnd() % 40;
+        for (size_t i = 0; i < len; ++i)
+            seq += alpha[rnd() % (sizeof(alpha) - 1)];
+        if (rnd() % 2)
+            seq = "host" + std::to_string(rnd() % 100) + ".example:8080";
+    }
+
+    std::vector<Outcome> expected;
+    {
+        IntCharSharedDfaPlayer player(dfa);
+        for (const std::string& seq : seqs)
+        {
+            PlayResult res = player.play(std::string_view(seq));
+            expected.push_back({res, player.getCurPos(), player.getCurState()});
+        }
+    }
+
+    const int threadsNum = 8;
+    const int rounds = 5;
+    std::atomic<int> mismatches(0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadsNum; ++t)
+    {
+        // every thread has a copy of the handle and a player of its own and
+        // walks the sequences in an order of its own
+        threads.emplace_back([&, t, dfa]()
+        {
+            IntCharSharedDfaPlayer player(dfa);
+            for (int r = 0; r < rounds; ++r)
+            {
+                for (size_t k = 0; k < seqs.size(); ++k)
+                {
+                    size_t i = (k * (2 * t + 1) + r) % seqs.size();
+                    PlayResult res = player.play(std::string_view(seqs[i]));
+                    Outcome got{res, player.getCurPos(), player.getCurState()};
+                    if (!(got == expected[i]))
+                        ++mismatches;
+                }
+            }
+        });
+    }
+    for (std::thread& th : threads)
+        th.join();
+
+    EXPECT_EQ(0, mismatches.load());
+    EXPECT_EQ(1, dfa.getUseCount());
+}
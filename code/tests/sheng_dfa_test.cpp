@@ -0,0 +1,130 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for ShengDfa and AutoDfa classes.
+///
+/// © DFA library contributors 2026.
+///
+/// This code is for educational purposes of the course "Algorithms and Data 
+/// Structures" provided by the School of Software Engineering of the Faculty 
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "fsa/auto_dfa.hpp"
+#include "fsa/regex.hpp"
+#include "same_as_dfa_player.hpp"
+
+
+typedef Dfa<int, char> IntCharDfa;
+typedef CompiledDfa<int, char> IntCharCompiledDfa;
+typedef ShengDfa<int, char> IntCharShengDfa;
+typedef ShengDfaPlayer<int, char> IntCharShengDfaPlayer;
+typedef AutoDfa<int, char> IntCharAutoDfa;
+typedef AutoDfaPlayer<int, char> IntCharAutoDfaPlayer;
+
+
+/// Makes random sequences of the symbols \a symbols of uneven lengths.
+static std::vector<std::string> makeShengInputs(const std::string& symbols)
+{
+    std::mt19937 rnd(17);
+    std::vector<std::string> strs(300);
+    for (std::string& s : strs)
+    {
+        size_t len = (rnd() % 10 == 0) ? rnd() % 5000 : rnd() % 300;
+        for (size_t i = 0; i < len; ++i)
+            s += symbols[rnd() % symbols.size()];
+    }
+
+    return strs;
+}
+
+
+TEST(ShengDfa, example1)
+{
+    IntCharDfa dfa{0,                           // init state
+                   { {0, '1', 0}, {0, '0', 1},  // trans table
+                     {1, '0', 1}, {1, '1', 2},
+                     {2, '0', 2}, {2, '1', 2}
+                   },
+                   { 2 }                        // fin states
+                  };
+    IntCharCompiledDfa cdfa(dfa);
+    EXPECT_EQ(4, IntCharShengDfa::getRowStatesNum(cdfa));  // and the dead one
+
+    std::vector<std::string> strs = makeShengInputs("0000011111112");
+    for (SimdLevel level : { SimdLevel::None, SimdLevel::Ssse3,
+                             SimdLevel::Avx512Vbmi })
+    {
+        IntCharShengDfa sdfa(cdfa, level);
+        EXPECT_EQ(16, sdfa.getWidth());
+        EXPECT_EQ(3, sdfa.getDeadIndex());
+        EXPECT_TRUE(sdfa.getSimdLevel() <= SimdLevel::Ssse3);
+
+        IntCharShengDfaPlayer player(sdfa);
+        expectSameAsDfaPlayer(dfa, player, strs);
+    }
+
+    IntCharAutoDfa adfa(dfa);
+    EXPECT_EQ(isSimdSupported(SimdLevel::Ssse3) ? DfaEngine::Sheng
+                                                : DfaEngine::Table,
+              adfa.getEngine());
+    IntCharAutoDfaPlayer player(adfa);
+    expectSameAsDfaPlayer(dfa, player, strs);
+}
+
+TEST(ShengDfa, wideRows)
+{
+    // (a|b)*a(a|b)^4 needs 32 states, more than a narrow row has
+    IntCharDfa dfa = RegexCompiler::compile("(a|b)*a(a|b)(a|b)(a|b)(a|b)");
+    IntCharCompiledDfa cdfa(dfa);
+    ASSERT_GT(IntCharShengDfa::getRowStatesNum(cdfa), 16);
+    ASSERT_LE(IntCharShengDfa::getRowStatesNum(cdfa), 64);
+
+    EXPECT_FALSE(IntCharShengDfa::isApplicable(cdfa, SimdLevel::Avx512));
+    EXPECT_THROW(IntCharShengDfa(cdfa, SimdLevel::Avx512),
+                 std::invalid_argument);
+
+    IntCharAutoDfa tdfa(cdfa, SimdLevel::Avx512);
+    EXPECT_EQ(DfaEngine::Table, tdfa.getEngine());
+    std::vector<std::string> strs = makeShengInputs("aaabbbbc");
+    IntCharAutoDfaPlayer tplayer(tdfa);
+    expectSameAsDfaPlayer(dfa, tplayer, strs);
+
+    if (!isSimdSupported(SimdLevel::Avx512Vbmi))
+        return;
+
+    IntCharShengDfa sdfa(cdfa);
+    EXPECT_EQ(64, sdfa.getWidth());
+    IntCharShengDfaPlayer player(sdfa);
+    expectSameAsDfaPlayer(dfa, player, strs);
+}
+
+TEST(ShengDfa, noDeadState)
+{
+    // a complete DFA over all the chars counts them modulo 16
+    IntCharDfa dfa;
+    for (int s = 0; s < 16; ++s)
+    {
+        for (int a = -128; a < 128; ++a)
+            dfa.addTrans(s, char(a), (a == 'x') ? (s + 1) % 16 : s);
+    }
+    dfa.setInitState(0);
+    dfa.addFinState(0);
+    IntCharCompiledDfa cdfa(dfa);
+    EXPECT_EQ(16, IntCharShengDfa::getRowStatesNum(cdfa));
+
+    IntCharShengDfa sdfa(cdfa);
+    EXPECT_EQ(16, sdfa.getWidth());
+    EXPECT_LE(16, sdfa.getDeadIndex());
+
+    IntCharShengDfaPlayer player(sdfa);
+    expectSameAsDfaPlayer(dfa, player, makeShengInputs("xxyz\n"));
+}
@@ -0,0 +1,107 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for StrideDfa class.
+///
+/// © DFA library contributors 2026.
+///
+/// This code is for educational purposes of the course "Algorithms and Data 
+/// Structures" provided by the School of Software Engineering of the Faculty 
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "fsa/auto_dfa.hpp"
+#include "fsa/regex.hpp"
+#include "same_as_dfa_player.hpp"
+
+
+typedef Dfa<int, char> IntCharDfa;
+typedef CompiledDfa<int, char> IntCharCompiledDfa;
+typedef StrideDfa<int, char> IntCharStrideDfa;
+typedef StrideDfaPlayer<int, char> IntCharStrideDfaPlayer;
+
+
+/// Checks replays of random sequences of \a symbols by \a player against
+/// the reference DfaPlayer.
+template<typename Player>
+static void expectStridesSameAsDfaPlayer(const IntCharDfa& dfa, Player& player,
+                                         const std::string& symbols)
+{
+    std::mt19937 rnd(23);
+    std::vector<std::string> strs(500);
+    for (std::string& s : strs)
+    {
+        size_t len = rnd() % 200;
+        for (size_t j = 0; j < len; ++j)
+            s += symbols[rnd() % symbols.size()];
+    }
+
+    expectSameAsDfaPlayer(dfa, player, strs);
+}
+
+
+TEST(StrideDfa, chooseStride)
+{
+    IntCharDfa dfa{0,                           // init state
+                   { {0, '1', 0}, {0, '0', 1},  // trans table
+                     {1, '0', 1}, {1, '1', 2},
+                     {2, '0', 2}, {2, '1', 2}
+                   },
+                   { 2 }                        // fin states
+                  };
+    IntCharCompiledDfa cdfa(dfa);
+
+    // 3 states by 3 classes (with the unknown one) to the power of stride
+    const size_t cell = sizeof(IntCharCompiledDfa::Index);
+    EXPECT_EQ(4, IntCharStrideDfa::chooseStride(cdfa, 3 * 81 * cell));
+    EXPECT_EQ(2, IntCharStrideDfa::chooseStride(cdfa, 3 * 81 * cell - 1));
+    EXPECT_EQ(2, IntCharStrideDfa::chooseStride(cdfa, 3 * 9 * cell));
+    EXPECT_EQ(1, IntCharStrideDfa::chooseStride(cdfa, 3 * 9 * cell - 1));
+    EXPECT_EQ(1, IntCharStrideDfa::chooseStride(cdfa, 0));
+    EXPECT_EQ(4, IntCharStrideDfa::chooseStride(cdfa, size_t(-1)));
+
+    for (size_t budget : { size_t(0), 3 * 9 * cell, 3 * 81 * cell })
+    {
+        IntCharStrideDfa sdfa(cdfa, budget);
+        EXPECT_LE(sdfa.getTableSize(), std::max(budget, 3 * 3 * cell));
+
+        IntCharStrideDfaPlayer player(sdfa);
+        expectStridesSameAsDfaPlayer(dfa, player, "0000011111112");
+    }
+}
+
+TEST(StrideDfa, sameAsPlayer)
+{
+    IntCharDfa dfa = RegexCompiler::compile("(a|b)*abb(c*|a)");
+    IntCharCompiledDfa cdfa(dfa);
+    for (size_t budget : { size_t(0), size_t(1) << 10, size_t(1) << 20 })
+    {
+        IntCharStrideDfa sdfa(cdfa, budget);
+        IntCharStrideDfaPlayer player(sdfa);
+        expectStridesSameAsDfaPlayer(dfa, player, "aaabbbbccx");
+    }
+
+    // Sheng takes precedence over strides
+    AutoDfa<int, char> sheng(cdfa, SimdLevel::Avx512Vbmi, 1 << 20);
+    if (isSimdSupported(SimdLevel::Ssse3))
+    {
+        EXPECT_EQ(DfaEngine::Sheng, sheng.getEngine());
+    }
+
+    AutoDfa<int, char> adfa(cdfa, SimdLevel::None, 1 << 20);
+    EXPECT_EQ(DfaEngine::Stride, adfa.getEngine());
+    EXPECT_EQ(4, adfa.getStrideDfa()->getStride());
+    AutoDfaPlayer<int, char> player(adfa);
+    expectStridesSameAsDfaPlayer(dfa, player, "aaabbbbccx");
+
+    AutoDfa<int, char> tdfa(cdfa, SimdLevel::None);
+    EXPECT_EQ(DfaEngine::Table, tdfa.getEngine());
+}
@@ -0,0 +1,83 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for WorkStealingPool class.
+///
+/// © DFA library contributors 2026.
+///
+/// This code is for educational purposes of the course "Algorithms and Data 
+/// Structures" provided by the School of Software Engineering of the Faculty 
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <functional>
+#include <vector>
+
+#include "fsa/thread_pool.hpp"
+
+
+TEST(WorkStealingPool, everyIndexOnce)
+{
+    for (size_t threadsNum : {1, 2, 4, 8})
+    {
+        WorkStealingPool pool(threadsNum);
+        EXPECT_EQ(threadsNum, pool.getThreadsNum());
+
+        // jobs of different sizes on the same pool
+        for (size_t n : {0, 1, 3, 1000, 100000})
+        {
+            std::vector<std::atomic<int>> hits(n);
+            for (std::atomic<int>& h : hits)
+                h = 0;
+            pool.parallelFor(n, [&hits](size_t i) { ++hits[i]; });
+
+            size_t once = 0;
+            for (const std::atomic<int>& h : hits)
+                once += (h.load() == 1);
+            EXPECT_EQ(n, once);
+        }
+    }
+}
+
+TEST(WorkStealingPool, unevenWork)
+{
+    WorkStealingPool pool(4);
+
+    // a few heavy indices at the start are to be stolen around them
+    const size_t n = 64;
+    std::vector<unsigned> sums(n, 0);
+    pool.parallelFor(n, [&sums](size_t i)
+    {
+        unsigned s = 0;
+        size_t steps = (i < 4) ? 2000000 : 1000;
+        for (size_t k = 0; k < steps; ++k)
+            s = s * 31 + unsigned(k ^ i);
+        sums[i] = s | 1;
+    });
+
+    for (size_t i = 0; i < n; ++i)
+        EXPECT_NE(0u, sums[i]);
+}
+
+TEST(WorkStealingPool, manySmallJobs)
+{
+    // threads woken late must not touch a body of a finished job, which is
+    // destroyed right after its parallelFor()
+    WorkStealingPool pool(4);
+    size_t total = 0;
+    for (size_t job = 0; job < 2000; ++job)
+    {
+        std::atomic<size_t> sum(0);
+        std::function<void (size_t)> body = [&sum](size_t i) { sum += i + 1; };
+        size_t n = 1 + job % 3;
+        pool.parallelFor(n, body);
+        EXPECT_EQ(n * (n + 1) / 2, sum.load());
+        total += sum;
+    }
+    EXPECT_EQ(6664u, total);
+}
@@ -0,0 +1,172 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for tracing classes.
+///
+/// © DFA library contributors 2026.
+///
+/// This code is for educational purposes of the course "Algorithms and Data 
+/// Structures" provided by the School of Software Engineering of the Faculty 
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "fsa/trace.hpp"
+
+
+typedef Dfa<int, char> IntCharDfa;
+typedef CompiledDfa<int, char> IntCharCompiledDfa;
+typedef TraceRecord<char> CharTraceRecord;
+typedef BasicCompiledDfaPlayer<int, char, TraceListener<char>> TracingPlayer;
+
+
+TEST(SpscRing, pushPop)
+{
+    SpscRing<int> ring(5);
+    EXPECT_EQ(8, ring.capacity());
+
+    int out[16];
+    EXPECT_EQ(0, ring.pop(out, 16));
+
+    // wrap around several times
+    int next = 0;
+    int expected = 0;
+    for (int round = 0; round < 5; ++round)
+    {
+        while (ring.tryPush(next))
+            ++next;
+        EXPECT_EQ(expected + 8, next);
+
+        size_t n = ring.pop(out, 3);
+        ASSERT_EQ(3, n);
+        n += ring.pop(out + 3, 16);
+        ASSERT_EQ(8, n);
+        for (size_t i = 0; i < n; ++i)
+            EXPECT_EQ(expected++, out[i]);
+    }
+}
+
+TEST(SpscRing, twoThreads)
+{
+    const int num = 200000;
+    SpscRing<int> ring(64);
+
+    std::thread producer([&ring]()
+    {
+        for (int i = 0; i < num; ++i)
+        {
+            while (!ring.tryPush(i))
+                std::this_thread::yield();
+        }
+    });
+
+    int expected = 0;
+    int out[32];
+    while (expected < num)
+    {
+        size_t n = ring.pop(out, 32);
+        for (size_t i = 0; i < n; ++i)
+            ASSERT_EQ(expected++, out[i]);
+        if (n == 0)
+            std::this_thread::yield();
+    }
+    producer.join();
+}
+
+TEST(TraceListener, traceReplay)
+{
+    IntCharDfa dfa{0,                           // init state
+                   { {0, '1', 0}, {0, '0', 1},  // trans table
+                     {1, '0', 1}, {1, '1', 2},
+                     {2, '0', 2}, {2, '1', 2}
+                   },
+                   { 2 }                        // fin states
+                  };
+    IntCharCompiledDfa cdfa(dfa);
+
+    TraceListener<char>::Ring ring(1 << 12);
+    std::vector<CharTraceRecord> recs;
+    {
+        TraceConsumer<char> consumer(ring, [&recs](const CharTraceRecord* r,
+                                                   size_t n)
+                                           { recs.insert(recs.end(), r, r + n); });
+
+        TracingPlayer player(cdfa, TraceListener<char>(ring));
+        EXPECT_EQ(PlayResult::Ok, player.play(std::string_view("1010")));
+        EXPECT_EQ(PlayResult::NoTrans, player.play(std::string_view("0x")));
+        EXPECT_FALSE(player.getListener().isOverflowed());
+        consumer.stop();
+    }
+
+    ASSERT_EQ(5, recs.size());
+    std::string trace;
+    for (const CharTraceRecord& r : recs)
+    {
+        trace += std::to_string(r.pos) + ':' + std::to_string(cdfa.getState(r.from))
+                + r.symbol + std::to_string(cdfa.getState(r.to)) + ' ';
+    }
+    EXPECT_EQ("0:010 1:001 2:112 3:202 0:001 ", trace);
+}
+
+TEST(TraceListener, overflow)
+{
+    IntCharDfa dfa{0, { {0, 'a', 0} }, { 0 }};
+    IntCharCompiledDfa cdfa(dfa);
+
+    // no consumer: the player drops what does not fit instead of blocking
+    TraceListener<char>::Ring ring(16);
+    TracingPlayer player(cdfa, TraceListener<char>(ring));
+    EXPECT_EQ(PlayResult::Ok, player.play(std::string(100, 'a').c_str(), 100));
+    EXPECT_TRUE(player.getListener().isOverflowed());
+    EXPECT_EQ(84, player.getListener().getDroppedNum());
+
+    // the kept records are the first ones
+    CharTraceRecord out[32];
+    ASSERT_EQ(16, ring.pop(out, 32));
+    EXPECT_EQ(0, out[0].pos);
+    EXPECT_EQ(15, out[15].pos);
+}
+
+TEST(TraceListener, longReplay)
+{
+    // every state of a cycle accepts
+    IntCharDfa dfa;
+    for (int s = 0; s < 100; ++s)
+    {
+        dfa.addTrans(s, 'a', (s + 1) % 100);
+        dfa.addTrans(s, 'b', s);
+        dfa.addFinState(s);
+    }
+    dfa.setInitState(0);
+    IntCharCompiledDfa cdfa(dfa);
+
+    std::string seq;
+    for (int i = 0; i < 100000; ++i)
+        seq += (i % 3) ? 'a' : 'b';
+
+    TraceListener<char>::Ring ring(1 << 10);
+    std::uint64_t count = 0;
+    std::uint64_t nextPos = 0;
+    bool ordered = true;
+    TraceConsumer<char> consumer(ring, [&](const CharTraceRecord* r, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
+            ordered = ordered && r[i].pos >= nextPos, nextPos = r[i].pos + 1;
+        count += n;
+    });
+
+    TracingPlayer player(cdfa, TraceListener<char>(ring));
+    EXPECT_EQ(PlayResult::Ok, player.play(std::string_view(seq)));
+    consumer.stop();
+
+    // whatever the scheduling, every record is either delivered or counted
+    EXPECT_TRUE(ordered);
+    EXPECT_EQ(seq.size(), count + player.getListener().getDroppedNum());
+}